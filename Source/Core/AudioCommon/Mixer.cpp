@@ -58,21 +58,18 @@ void Mixer::DoState(PointerWrap& p)
 }
 
 // Executed from sound stream thread
-unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
+unsigned int Mixer::MixerFifo::Mix(s32* samples, unsigned int numSamples,
                                    bool consider_framelimit, float emulationspeed,
                                    int timing_variance)
 {
   unsigned int currentSample = 0;
 
-  // Cache access in non-volatile variable
-  // This is the only function changing the read value, so it's safe to
-  // cache it locally although it's written here.
-  // The writing pointer will be modified outside, but it will only increase,
-  // so we will just ignore new written data while interpolating.
-  // Without this cache, the compiler wouldn't be allowed to optimize the
-  // interpolation loop.
-  u32 indexR = m_indexR.load();
-  u32 indexW = m_indexW.load();
+  // This is the only function changing the read index, so it doesn't need any ordering with
+  // respect to itself. The acquire load of the write index pairs with the release in PushSamples
+  // and makes every sample before it visible. The writing pointer will be modified outside, but
+  // it will only increase, so we will just ignore new written data while interpolating.
+  u32 indexR = m_indexR.load(std::memory_order_relaxed);
+  const u32 indexW = m_indexW.load(std::memory_order_acquire);
 
   // render numleft sample pairs to samples[]
   // advance indexR with sample position
@@ -100,68 +97,134 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
 
   const u32 ratio = (u32)(65536.0f * aid_sample_rate / (float)m_mixer->m_sampleRate);
 
-  s32 lvolume = m_LVolume.load();
-  s32 rvolume = m_RVolume.load();
+  const float lvolume = m_LVolume.load(std::memory_order_relaxed) / 256.0f;
+  const float rvolume = m_RVolume.load(std::memory_order_relaxed) / 256.0f;
 
   const auto read_buffer = [this](auto index) {
     return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
   };
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  // Catmull-Rom interpolation needs the frame before the current position and the two after it.
+  // The one before has already been consumed, so it is kept in m_prev_left/m_prev_right instead
+  // of being read back from the ring (where the writer may already have replaced it).
+  s16 prev_left = m_prev_left.load(std::memory_order_relaxed);
+  s16 prev_right = m_prev_right.load(std::memory_order_relaxed);
+  std::array<float, RESAMPLE_BATCH> frac;
+  std::array<std::array<float, RESAMPLE_BATCH>, 4> taps_left;
+  std::array<std::array<float, RESAMPLE_BATCH>, 4> taps_right;
+
+  while (currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 4)
   {
-    u32 indexR2 = indexR + 2;  // next sample
-
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
-
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
-
-    m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
-    m_frac &= 0xffff;
+    // Walk the input positions and gather the input frames each output sample needs. This is the
+    // only part with a loop-carried dependency.
+    u32 count = 0;
+    for (; count < RESAMPLE_BATCH && currentSample + count * 2 < numSamples * 2 &&
+           ((indexW - indexR) & INDEX_MASK) > 4;
+         ++count)
+    {
+      frac[count] = static_cast<float>(m_frac) / 65536.0f;
+      taps_left[0][count] = prev_left;
+      taps_right[0][count] = prev_right;
+      for (u32 tap = 1; tap < 4; ++tap)
+      {
+        taps_left[tap][count] = read_buffer((indexR + 2 * (tap - 1)) & INDEX_MASK);
+        taps_right[tap][count] = read_buffer((indexR + 2 * (tap - 1) + 1) & INDEX_MASK);
+      }
+
+      m_frac += ratio;
+      const u32 advance = m_frac >> 16;
+      m_frac &= 0xffff;
+      if (advance != 0)
+      {
+        indexR += 2 * advance;
+        prev_left = read_buffer((indexR - 2) & INDEX_MASK);
+        prev_right = read_buffer((indexR - 1) & INDEX_MASK);
+      }
+    }
+
+    // Interpolate and accumulate the whole batch. This loop is independent per sample, which lets
+    // the compiler vectorize it.
+    s32* out = samples + currentSample;
+    for (u32 i = 0; i < count; ++i)
+    {
+      const float t = frac[i];
+      const float t2 = t * t;
+      const float t3 = t2 * t;
+      const float w0 = 0.5f * (-t3 + 2.0f * t2 - t);
+      const float w1 = 0.5f * (3.0f * t3 - 5.0f * t2 + 2.0f);
+      const float w2 = 0.5f * (-3.0f * t3 + 4.0f * t2 + t);
+      const float w3 = 0.5f * (t3 - t2);
+
+      const float left = w0 * taps_left[0][i] + w1 * taps_left[1][i] + w2 * taps_left[2][i] +
+                         w3 * taps_left[3][i];
+      const float right = w0 * taps_right[0][i] + w1 * taps_right[1][i] +
+                          w2 * taps_right[2][i] + w3 * taps_right[3][i];
+
+      out[i * 2] += static_cast<s32>(right * rvolume);
+      out[i * 2 + 1] += static_cast<s32>(left * lvolume);
+    }
+
+    currentSample += count * 2;
   }
 
   // Actual number of samples written to the buffer without padding.
   unsigned int actual_sample_count = currentSample / 2;
 
   // Padding
-  short s[2];
-  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
-  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
-  s[0] = (s[0] * rvolume) >> 8;
-  s[1] = (s[1] * lvolume) >> 8;
+  const s32 pad_right = static_cast<s32>(prev_right * rvolume);
+  const s32 pad_left = static_cast<s32>(prev_left * lvolume);
   for (; currentSample < numSamples * 2; currentSample += 2)
   {
-    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
-    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
-
-    samples[currentSample + 0] = sampleR;
-    samples[currentSample + 1] = sampleL;
+    samples[currentSample + 0] += pad_right;
+    samples[currentSample + 1] += pad_left;
   }
 
-  // Flush cached variable
-  m_indexR.store(indexR);
+  m_prev_left.store(prev_left, std::memory_order_relaxed);
+  m_prev_right.store(prev_right, std::memory_order_relaxed);
+
+  // Hand the consumed part of the ring back to the writer only after we are done reading it.
+  m_indexR.store(indexR, std::memory_order_release);
 
   return actual_sample_count;
 }
 
+void Mixer::MixAllFifos(short* samples, unsigned int num_samples, bool consider_framelimit,
+                        float emulation_speed, int timing_variance)
+{
+  // All FIFOs are summed at full precision and only clamped once at the end, rather than
+  // saturating the output after every FIFO.
+  while (num_samples > 0)
+  {
+    const unsigned int count = std::min(num_samples, MAX_SAMPLES);
+    std::fill_n(m_accumulator.begin(), count * 2, 0);
+
+    m_dma_mixer.Mix(m_accumulator.data(), count, consider_framelimit, emulation_speed,
+                    timing_variance);
+    m_streaming_mixer.Mix(m_accumulator.data(), count, consider_framelimit, emulation_speed,
+                          timing_variance);
+    m_wiimote_speaker_mixer.Mix(m_accumulator.data(), count, consider_framelimit,
+                                emulation_speed, timing_variance);
+    m_skylander_portal_mixer.Mix(m_accumulator.data(), count, consider_framelimit,
+                                 emulation_speed, timing_variance);
+    for (auto& mixer : m_gba_mixers)
+    {
+      mixer.Mix(m_accumulator.data(), count, consider_framelimit, emulation_speed,
+                timing_variance);
+    }
+
+    for (unsigned int i = 0; i < count * 2; ++i)
+      samples[i] = static_cast<short>(std::clamp(m_accumulator[i], -32767, 32767));
+
+    samples += count * 2;
+    num_samples -= count;
+  }
+}
+
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
   if (!samples)
     return 0;
 
-  memset(samples, 0, num_samples * 2 * sizeof(short));
-
   // TODO: Determine how emulation speed will be used in audio
   // const float emulation_speed = g_perf_metrics.GetSpeed();
   const float emulation_speed = m_config_emulation_speed;
@@ -176,21 +239,8 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
                m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples(),
                available_samples, MAX_SAMPLES, num_samples);
 
-    m_scratch_buffer.fill(0);
-
-    m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                    timing_variance);
-    m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                          timing_variance);
-    m_wiimote_speaker_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                timing_variance);
-    m_skylander_portal_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                 timing_variance);
-    for (auto& mixer : m_gba_mixers)
-    {
-      mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
+    MixAllFifos(m_scratch_buffer.data(), available_samples, false, emulation_speed,
                 timing_variance);
-    }
 
     if (!m_is_stretching)
     {
@@ -202,12 +252,7 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_skylander_portal_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    for (auto& mixer : m_gba_mixers)
-      mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    MixAllFifos(samples, num_samples, true, emulation_speed, timing_variance);
     m_is_stretching = false;
   }
 
@@ -245,15 +290,17 @@ unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
 
 void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_samples)
 {
-  // Cache access in non-volatile variable
-  // indexR isn't allowed to cache in the audio throttling loop as it
-  // needs to get updates to not deadlock.
-  u32 indexW = m_indexW.load();
+  // Only this function changes the write index. The acquire load of the read index pairs with the
+  // release in Mix, so the reader is guaranteed to be done with any space we are about to reuse.
+  u32 indexW = m_indexW.load(std::memory_order_relaxed);
 
   // Check if we have enough free space
   // indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW
-  if (num_samples * 2 + ((indexW - m_indexR.load()) & INDEX_MASK) >= MAX_SAMPLES * 2)
+  if (num_samples * 2 + ((indexW - m_indexR.load(std::memory_order_acquire)) & INDEX_MASK) >=
+      MAX_SAMPLES * 2)
+  {
     return;
+  }
 
   // AyuanX: Actual re-sampling work has been moved to sound thread
   // to alleviate the workload on main thread
@@ -269,7 +316,8 @@ void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_sample
     memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4);
   }
 
-  m_indexW.fetch_add(num_samples * 2);
+  // Publish the new samples to the reader.
+  m_indexW.store(indexW + num_samples * 2, std::memory_order_release);
 }
 
 void Mixer::PushSamples(const short* samples, unsigned int num_samples)
@@ -465,6 +513,8 @@ void Mixer::MixerFifo::DoState(PointerWrap& p)
   p.Do(m_input_sample_rate_divisor);
   p.Do(m_LVolume);
   p.Do(m_RVolume);
+  p.Do(m_prev_left);
+  p.Do(m_prev_right);
 }
 
 void Mixer::MixerFifo::SetInputSampleRateDivisor(unsigned int rate_divisor)
@@ -490,9 +540,12 @@ std::pair<s32, s32> Mixer::MixerFifo::GetVolume() const
 
 unsigned int Mixer::MixerFifo::AvailableSamples() const
 {
-  unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & INDEX_MASK) / 2;
-  if (samples_in_fifo <= 1)
-    return 0;  // Mixer::MixerFifo::Mix always keeps one sample in the buffer.
-  return (samples_in_fifo - 1) * static_cast<u64>(m_mixer->m_sampleRate) *
+  unsigned int samples_in_fifo =
+      ((m_indexW.load(std::memory_order_acquire) - m_indexR.load(std::memory_order_acquire)) &
+       INDEX_MASK) /
+      2;
+  if (samples_in_fifo <= 2)
+    return 0;  // Mixer::MixerFifo::Mix always keeps two samples in the buffer.
+  return (samples_in_fifo - 2) * static_cast<u64>(m_mixer->m_sampleRate) *
          m_input_sample_rate_divisor / FIXED_SAMPLE_RATE_DIVIDEND;
 }
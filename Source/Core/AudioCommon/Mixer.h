@@ -59,6 +59,7 @@ private:
   static constexpr int MAX_FREQ_SHIFT = 200;  // Per 32000 Hz
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
+  static constexpr u32 RESAMPLE_BATCH = 64;  // Output samples interpolated per inner loop
 
   const unsigned int SURROUND_CHANNELS = 6;
 
@@ -72,7 +73,9 @@ private:
     }
     void DoState(PointerWrap& p);
     void PushSamples(const short* samples, unsigned int num_samples);
-    unsigned int Mix(short* samples, unsigned int numSamples, bool consider_framelimit,
+    // Resamples into samples and adds the result to what is already there. The output is not
+    // clamped, that is done once all FIFOs have been mixed.
+    unsigned int Mix(s32* samples, unsigned int numSamples, bool consider_framelimit,
                      float emulationspeed, int timing_variance);
     void SetInputSampleRateDivisor(unsigned int rate_divisor);
     unsigned int GetInputSampleRateDivisor() const;
@@ -85,6 +88,8 @@ private:
     unsigned m_input_sample_rate_divisor;
     bool m_little_endian;
     std::array<short, MAX_SAMPLES * 2> m_buffer{};
+    // Single producer (PushSamples), single consumer (Mix). Each side only writes its own index
+    // and publishes it with release semantics once it is done with the buffer contents.
     std::atomic<u32> m_indexW{0};
     std::atomic<u32> m_indexR{0};
     // Volume ranges from 0-256
@@ -92,8 +97,14 @@ private:
     std::atomic<s32> m_RVolume{256};
     float m_numLeftI = 0.0f;
     u32 m_frac = 0;
+    // The last input frame that Mix consumed, used as the first interpolation tap. Mix works on a
+    // copy; these are only atomic so that savestates can access them from the CPU thread.
+    std::atomic<s16> m_prev_left{0};
+    std::atomic<s16> m_prev_right{0};
   };
 
+  void MixAllFifos(short* samples, unsigned int num_samples, bool consider_framelimit,
+                   float emulation_speed, int timing_variance);
   void RefreshConfig();
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
@@ -110,6 +121,7 @@ private:
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
   std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  std::array<s32, MAX_SAMPLES * 2> m_accumulator{};
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
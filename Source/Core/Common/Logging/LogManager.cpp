@@ -21,6 +21,7 @@
 #include "Common/Logging/ConsoleListener.h"
 #include "Common/Logging/Log.h"
 #include "Common/StringUtil.h"
+#include "Common/Thread.h"
 
 namespace Common::Log
 {
@@ -169,10 +170,17 @@ LogManager::LogManager()
   }
 
   m_path_cutoff_point = DeterminePathCutOffPoint();
+
+  m_writer_running.Set();
+  m_writer_thread = std::thread(&LogManager::WriterThread, this);
 }
 
 LogManager::~LogManager()
 {
+  m_writer_running.Clear();
+  m_queue_event.Set();
+  m_writer_thread.join();
+
   // The log window listener pointer is owned by the GUI code.
   delete m_listeners[LogListener::CONSOLE_LISTENER];
   delete m_listeners[LogListener::FILE_LISTENER];
@@ -206,29 +214,115 @@ void LogManager::Log(LogLevel level, LogType type, const char* file, int line, c
   LogWithFullPath(level, type, file + m_path_cutoff_point, line, message);
 }
 
-std::string LogManager::GetTimestamp()
+std::string LogManager::GetTimestamp(std::chrono::system_clock::time_point time)
 {
   // NOTE: the Qt LogWidget hardcodes the expected length of the timestamp portion of the log line,
   // so ensure they stay in sync
 
   // We want milliseconds *and not hours*, so can't directly use STL formatters
-  const auto now = std::chrono::system_clock::now();
-  const auto now_s = std::chrono::floor<std::chrono::seconds>(now);
-  const auto now_ms = std::chrono::floor<std::chrono::milliseconds>(now);
-  return fmt::format("{:%M:%S}:{:03}", now_s, (now_ms - now_s).count());
+  const auto time_s = std::chrono::floor<std::chrono::seconds>(time);
+  const auto time_ms = std::chrono::floor<std::chrono::milliseconds>(time);
+  return fmt::format("{:%M:%S}:{:03}", time_s, (time_ms - time_s).count());
 }
 
 void LogManager::LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                                  const char* message)
 {
-  const std::string msg =
-      fmt::format("{} {}:{} {}[{}]: {}\n", GetTimestamp(), file, line,
-                  LOG_LEVEL_TO_CHAR[static_cast<int>(level)], GetShortName(type), message);
+  LogEntry entry;
+  entry.time = std::chrono::system_clock::now();
+  entry.level = level;
+  entry.type = type;
+  entry.file = file;
+  entry.line = line;
+  entry.message = message;
+
+  Enqueue(std::move(entry), false);
+}
+
+void LogManager::Flush()
+{
+  LogEntry entry;
+  entry.file = nullptr;
+  Enqueue(std::move(entry), true);
+}
+
+void LogManager::Enqueue(LogEntry entry, bool wait)
+{
+  // Listeners may log themselves. Their messages can't be waited for, since they are written out
+  // by this very thread, but they'll be picked up before it goes back to sleep.
+  if (std::this_thread::get_id() == m_writer_thread.get_id())
+    wait = false;
+
+  if (!wait && entry.level != LogLevel::LERROR &&
+      m_queued_entries.load(std::memory_order_relaxed) >= MAX_QUEUED_ENTRIES)
+  {
+    m_dropped_entries.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  std::future<void> written;
+  if (wait)
+    written = entry.written.emplace().get_future();
+
+  m_queued_entries.fetch_add(1, std::memory_order_relaxed);
+  m_queue.Push(std::move(entry));
+  m_queue_event.Set();
+
+  if (wait)
+    written.wait();
+}
+
+void LogManager::WriterThread()
+{
+  Common::SetCurrentThreadName("Log Writer");
 
+  while (m_writer_running.IsSet())
+  {
+    m_queue_event.Wait();
+    WriteQueuedEntries();
+  }
+
+  // Anything that was logged before shutting down still needs to be written out.
+  WriteQueuedEntries();
+}
+
+void LogManager::WriteQueuedEntries()
+{
+  LogEntry entry;
+  while (m_queue.Pop(entry))
+  {
+    m_queued_entries.fetch_sub(1, std::memory_order_relaxed);
+
+    if (entry.file)
+      Write(entry);
+    if (entry.written)
+      entry.written->set_value();
+  }
+
+  if (const u64 dropped = m_dropped_entries.exchange(0, std::memory_order_relaxed); dropped != 0)
+  {
+    LogEntry notice;
+    notice.time = std::chrono::system_clock::now();
+    notice.level = LogLevel::LWARNING;
+    notice.type = LogType::COMMON;
+    notice.file = __FILE__ + m_path_cutoff_point;
+    notice.line = __LINE__;
+    notice.message = fmt::format("{} log messages were dropped because the log was full", dropped);
+    Write(notice);
+  }
+}
+
+void LogManager::Write(const LogEntry& entry)
+{
+  const std::string msg = fmt::format(
+      "{} {}:{} {}[{}]: {}\n", GetTimestamp(entry.time), entry.file, entry.line,
+      LOG_LEVEL_TO_CHAR[static_cast<int>(entry.level)], GetShortName(entry.type), entry.message);
+
+  std::lock_guard lk(m_listener_lock);
   for (const auto listener_id : m_listener_ids)
   {
     if (m_listeners[listener_id])
-      m_listeners[listener_id]->Log(level, msg.c_str());
+      m_listeners[listener_id]->Log(entry.level, msg.c_str());
   }
 }
 
@@ -274,11 +368,14 @@ const char* LogManager::GetFullName(LogType type) const
 
 void LogManager::RegisterListener(LogListener::LISTENER id, LogListener* listener)
 {
+  // Once this returns, the writer thread is guaranteed not to use the previous listener anymore.
+  std::lock_guard lk(m_listener_lock);
   m_listeners[id] = listener;
 }
 
 void LogManager::EnableListener(LogListener::LISTENER id, bool enable)
 {
+  std::lock_guard lk(m_listener_lock);
   m_listener_ids[id] = enable;
 }
 
@@ -303,7 +400,10 @@ void LogManager::Init()
 void LogManager::Shutdown()
 {
   if (s_log_manager)
+  {
+    s_log_manager->Flush();
     s_log_manager->SaveSettings();
+  }
   delete s_log_manager;
   s_log_manager = nullptr;
 }
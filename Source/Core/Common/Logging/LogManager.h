@@ -4,13 +4,23 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdarg>
+#include <future>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 
 #include "Common/BitSet.h"
+#include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
 #include "Common/Logging/Log.h"
+#include "Common/MPSCQueue.h"
 
 namespace Common::Log
 {
@@ -31,6 +41,9 @@ public:
   };
 };
 
+// Messages are formatted on the calling thread and then handed to a background thread, which
+// prefixes them and passes them to the listeners. This keeps slow listeners (the console in
+// particular) off the emulation threads.
 class LogManager
 {
 public:
@@ -38,10 +51,15 @@ public:
   static void Init();
   static void Shutdown();
 
+  // file must point to a string that stays alive until the message has been written out, which
+  // is the case for __FILE__.
   void Log(LogLevel level, LogType type, const char* file, int line, const char* message);
   void LogWithFullPath(LogLevel level, LogType type, const char* file, int line,
                        const char* message);
 
+  // Blocks until every message that was logged before the call has reached the listeners.
+  void Flush();
+
   LogLevel GetLogLevel() const;
   void SetLogLevel(LogLevel level);
 
@@ -67,6 +85,25 @@ private:
     bool m_enable = false;
   };
 
+  struct LogEntry
+  {
+    std::chrono::system_clock::time_point time;
+    LogLevel level = LogLevel::LNOTICE;
+    LogType type = LogType::COMMON;
+    const char* file = "";
+    int line = 0;
+    std::string message;
+
+    // Set for entries whose caller waits for them to be written out. Entries pushed by Flush
+    // have no file and are not written out themselves.
+    std::optional<std::promise<void>> written;
+  };
+
+  // Messages that are logged while this many are still waiting to be written out get dropped
+  // (unless they are errors), so that a thread spamming the log can't make the queue grow without
+  // bounds.
+  static constexpr u32 MAX_QUEUED_ENTRIES = 0x10000;
+
   LogManager();
   ~LogManager();
 
@@ -75,12 +112,27 @@ private:
   LogManager(LogManager&&) = delete;
   LogManager& operator=(LogManager&&) = delete;
 
-  static std::string GetTimestamp();
+  static std::string GetTimestamp(std::chrono::system_clock::time_point time);
+
+  void Enqueue(LogEntry entry, bool wait);
+  void WriterThread();
+  void WriteQueuedEntries();
+  void Write(const LogEntry& entry);
 
   LogLevel m_level;
   EnumMap<LogContainer, LAST_LOG_TYPE> m_log{};
   std::array<LogListener*, LogListener::NUMBER_OF_LISTENERS> m_listeners{};
   BitSet32 m_listener_ids;
   size_t m_path_cutoff_point = 0;
+
+  // Guards m_listeners and m_listener_ids against changes while a message is being written out.
+  std::mutex m_listener_lock;
+
+  Common::MPSCQueue<LogEntry> m_queue;
+  std::atomic<u32> m_queued_entries = 0;
+  std::atomic<u64> m_dropped_entries = 0;
+  Common::Event m_queue_event;
+  Common::Flag m_writer_running;
+  std::thread m_writer_thread;
 };
 }  // namespace Common::Log
@@ -0,0 +1,88 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// a lockless thread-safe,
+// multiple producer, single consumer queue
+//
+// Push may be called from any thread. Everything else must only be called from the consumer.
+// An element that is still being pushed when the consumer looks at the queue can make the
+// elements pushed after it invisible until its Push call returns.
+
+#include <atomic>
+#include <utility>
+
+namespace Common
+{
+template <typename T>
+class MPSCQueue
+{
+public:
+  MPSCQueue() { m_head.store(m_tail = new Node()); }
+  ~MPSCQueue()
+  {
+    while (m_tail)
+    {
+      Node* next = m_tail->next.load();
+      delete m_tail;
+      m_tail = next;
+    }
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+  template <typename Arg>
+  void Push(Arg&& t)
+  {
+    Node* node = new Node();
+    node->current = std::forward<Arg>(t);
+    Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  bool Empty() const { return !m_tail->next.load(std::memory_order_acquire); }
+  T& Front() const { return m_tail->next.load(std::memory_order_acquire)->current; }
+
+  void Pop()
+  {
+    Node* next = m_tail->next.load(std::memory_order_acquire);
+    delete m_tail;
+    // the front element becomes the new stub, so release what it holds right away
+    m_tail = next;
+    m_tail->current = T{};
+  }
+
+  bool Pop(T& t)
+  {
+    Node* next = m_tail->next.load(std::memory_order_acquire);
+    if (!next)
+      return false;
+
+    t = std::move(next->current);
+    delete m_tail;
+    m_tail = next;
+    m_tail->current = T{};
+    return true;
+  }
+
+  void Clear()
+  {
+    while (!Empty())
+      Pop();
+  }
+
+private:
+  struct Node
+  {
+    T current{};
+    std::atomic<Node*> next{nullptr};
+  };
+
+  // most recently pushed node, written by producers
+  std::atomic<Node*> m_head;
+  // stub node in front of the oldest element, only touched by the consumer
+  Node* m_tail;
+};
+}  // namespace Common
@@ -17,6 +17,7 @@
 #include "Common/Common.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/Logging/LogManager.h"
 #include "Common/StringUtil.h"
 
 namespace Common
@@ -115,6 +116,11 @@ static bool ShowMessageAlert(std::string_view text, bool yes_no, Common::Log::Lo
   Common::Log::GenericLogFmt<2>(Common::Log::LogLevel::LERROR, log_type, file, line,
                                 FMT_STRING("{}: {}"), caption, text);
 
+  // Log messages are written out on a background thread. Make sure everything up to the alert
+  // has made it out, in case we abort or the user decides to close the emulator.
+  if (auto* log_manager = Common::Log::LogManager::GetInstance())
+    log_manager->Flush();
+
   // Panic alerts.
   if (style == MsgType::Warning && s_abort_on_panic_alert)
   {
@@ -3,11 +3,15 @@
 
 #include "Core/CheatSearch.h"
 
+#include <algorithm>
 #include <bit>
+#include <cstring>
 #include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -15,6 +19,7 @@
 #include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/StringUtil.h"
+#include "Common/Swap.h"
 
 #include "Core/AchievementManager.h"
 #include "Core/Core.h"
@@ -201,11 +206,132 @@ TryReadValueFromEmulatedMemory(const Core::CPUThreadGuard& guard, u32 addr,
 }  // namespace
 
 template <typename T>
-Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
-Cheats::NewSearch(const Core::CPUThreadGuard& guard,
-                  const std::vector<Cheats::MemoryRange>& memory_ranges,
-                  PowerPC::RequestedAddressSpace address_space, bool aligned,
-                  const std::function<bool(const T& value)>& validator)
+static T ReadBigEndianValue(const u8* data)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  return Common::FromBigEndian(value);
+}
+
+// Whether values read through HostGetRAMPagePointer count as translated, matching what the
+// HostTryRead functions report.
+static bool IsTranslatedAddressSpace(const Core::CPUThreadGuard& guard,
+                                     PowerPC::RequestedAddressSpace address_space)
+{
+  switch (address_space)
+  {
+  case PowerPC::RequestedAddressSpace::Effective:
+    return guard.GetSystem().GetPPCState().msr.DR;
+  case PowerPC::RequestedAddressSpace::Physical:
+    return false;
+  case PowerPC::RequestedAddressSpace::Virtual:
+    return true;
+  }
+  return false;
+}
+
+// Copies a range of emulated memory in one go so that it can be scanned without going through
+// the MMU for every value. Returns an empty vector if any page of the range can't be read
+// directly, in which case every value has to be read through the MMU instead.
+static std::vector<u8> SnapshotMemoryRange(const Core::CPUThreadGuard& guard, u32 start_address,
+                                           u64 length,
+                                           PowerPC::RequestedAddressSpace address_space)
+{
+  std::vector<u8> snapshot(length);
+  for (u64 offset = 0; offset < length;)
+  {
+    const u32 address = static_cast<u32>(start_address + offset);
+    const u32 page_offset = address & PowerPC::HW_PAGE_MASK;
+    const u64 size = std::min<u64>(PowerPC::HW_PAGE_SIZE - page_offset, length - offset);
+
+    const u8* page = PowerPC::MMU::HostGetRAMPagePointer(guard, address, address_space);
+    if (!page)
+      return {};
+
+    std::memcpy(snapshot.data() + offset, page + page_offset, size);
+    offset += size;
+  }
+  return snapshot;
+}
+
+// Checks count values that are stride bytes apart. Matches are collected into a bitmask for
+// every 64 values first, which keeps the comparison loop free of branches and lets the compiler
+// vectorize it for the simple comparators that RunSearch passes in.
+template <typename T, typename Validator>
+static void ScanSnapshot(const u8* data, u64 count, u32 stride, u32 first_address,
+                         Cheats::SearchResultValueState value_state, const Validator& validator,
+                         std::vector<Cheats::SearchResult<T>>* results)
+{
+  for (u64 block = 0; block < count; block += 64)
+  {
+    const u32 block_size = static_cast<u32>(std::min<u64>(64, count - block));
+    const u8* block_data = data + block * stride;
+
+    u64 matches = 0;
+    for (u32 i = 0; i < block_size; ++i)
+      matches |= u64{validator(ReadBigEndianValue<T>(block_data + i * stride))} << i;
+
+    while (matches != 0)
+    {
+      const u32 i = static_cast<u32>(std::countr_zero(matches));
+      matches &= matches - 1;
+
+      auto& r = results->emplace_back();
+      r.m_value = ReadBigEndianValue<T>(block_data + i * stride);
+      r.m_value_state = value_state;
+      r.m_address = static_cast<u32>(first_address + (block + i) * stride);
+    }
+  }
+}
+
+// Scanning is split across threads for ranges with at least this many values.
+constexpr u64 MIN_VALUES_PER_SCAN_THREAD = 0x40000;
+
+template <typename T, typename Validator>
+static void ScanSnapshotMultithreaded(const std::vector<u8>& snapshot, u64 count, u32 stride,
+                                      u32 first_address,
+                                      Cheats::SearchResultValueState value_state,
+                                      const Validator& validator,
+                                      std::vector<Cheats::SearchResult<T>>* results)
+{
+  const u64 threads =
+      std::clamp<u64>(count / MIN_VALUES_PER_SCAN_THREAD, 1,
+                      std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+  if (threads == 1)
+  {
+    ScanSnapshot<T>(snapshot.data(), count, stride, first_address, value_state, validator,
+                    results);
+    return;
+  }
+
+  // Every thread gets its own results, which are then appended in order so that the results
+  // stay sorted by address.
+  std::vector<std::vector<Cheats::SearchResult<T>>> thread_results(threads);
+  std::vector<std::future<void>> futures(threads);
+  for (u64 i = 0; i < threads; ++i)
+  {
+    const u64 begin = i * count / threads;
+    const u64 end = (i + 1) * count / threads;
+    futures[i] = std::async(std::launch::async, [&, i, begin, end] {
+      ScanSnapshot<T>(snapshot.data() + begin * stride, end - begin, stride,
+                      static_cast<u32>(first_address + begin * stride), value_state, validator,
+                      &thread_results[i]);
+    });
+  }
+
+  for (u64 i = 0; i < threads; ++i)
+  {
+    futures[i].get();
+    results->insert(results->end(), thread_results[i].begin(), thread_results[i].end());
+  }
+}
+
+template <typename T, typename Validator>
+static Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
+NewSearchImpl(const Core::CPUThreadGuard& guard,
+              const std::vector<Cheats::MemoryRange>& memory_ranges,
+              PowerPC::RequestedAddressSpace address_space, bool aligned,
+              const Validator& validator)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return Cheats::SearchErrorCode::DisabledInHardcoreMode;
@@ -219,6 +345,11 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  const Cheats::SearchResultValueState snapshot_value_state =
+      IsTranslatedAddressSpace(guard, address_space) ?
+          Cheats::SearchResultValueState::ValueFromVirtualMemory :
+          Cheats::SearchResultValueState::ValueFromPhysicalMemory;
+
   for (const Cheats::MemoryRange& range : memory_ranges)
   {
     if (range.m_length < sizeof(T))
@@ -232,6 +363,17 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
       continue;
 
     const u64 length = aligned_length - (sizeof(T) - 1);
+
+    const std::vector<u8> snapshot =
+        SnapshotMemoryRange(guard, start_address, aligned_length, address_space);
+    if (!snapshot.empty())
+    {
+      const u64 count = (length + increment_per_loop - 1) / increment_per_loop;
+      ScanSnapshotMultithreaded<T>(snapshot, count, increment_per_loop, start_address,
+                                   snapshot_value_state, validator, &results);
+      continue;
+    }
+
     for (u64 i = 0; i < length; i += increment_per_loop)
     {
       const u32 addr = start_address + i;
@@ -255,10 +397,19 @@ Cheats::NewSearch(const Core::CPUThreadGuard& guard,
 
 template <typename T>
 Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
-Cheats::NextSearch(const Core::CPUThreadGuard& guard,
-                   const std::vector<Cheats::SearchResult<T>>& previous_results,
-                   PowerPC::RequestedAddressSpace address_space,
-                   const std::function<bool(const T& new_value, const T& old_value)>& validator)
+Cheats::NewSearch(const Core::CPUThreadGuard& guard,
+                  const std::vector<Cheats::MemoryRange>& memory_ranges,
+                  PowerPC::RequestedAddressSpace address_space, bool aligned,
+                  const std::function<bool(const T& value)>& validator)
+{
+  return NewSearchImpl<T>(guard, memory_ranges, address_space, aligned, validator);
+}
+
+template <typename T, typename Validator>
+static Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
+NextSearchImpl(const Core::CPUThreadGuard& guard,
+               const std::vector<Cheats::SearchResult<T>>& previous_results,
+               PowerPC::RequestedAddressSpace address_space, const Validator& validator)
 {
   if (AchievementManager::GetInstance().IsHardcoreModeActive())
     return Cheats::SearchErrorCode::DisabledInHardcoreMode;
@@ -272,10 +423,35 @@ Cheats::NextSearch(const Core::CPUThreadGuard& guard,
   if (address_space == PowerPC::RequestedAddressSpace::Virtual && !ppc_state.msr.DR)
     return Cheats::SearchErrorCode::VirtualAddressesCurrentlyNotAccessible;
 
+  const bool translated = IsTranslatedAddressSpace(guard, address_space);
+
+  // Previous results are sorted by address, so consecutive results usually share a page.
+  std::optional<u32> cached_page;
+  const u8* cached_page_pointer = nullptr;
+
   for (const auto& previous_result : previous_results)
   {
     const u32 addr = previous_result.m_address;
-    const auto current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+
+    std::optional<PowerPC::ReadResult<T>> current_value;
+    const u32 page_offset = addr & PowerPC::HW_PAGE_MASK;
+    if (page_offset + sizeof(T) <= PowerPC::HW_PAGE_SIZE)
+    {
+      const u32 page = addr - page_offset;
+      if (cached_page != page)
+      {
+        cached_page = page;
+        cached_page_pointer = PowerPC::MMU::HostGetRAMPagePointer(guard, page, address_space);
+      }
+      if (cached_page_pointer)
+      {
+        current_value.emplace(translated,
+                              ReadBigEndianValue<T>(cached_page_pointer + page_offset));
+      }
+    }
+    if (!current_value)
+      current_value = TryReadValueFromEmulatedMemory<T>(guard, addr, address_space);
+
     if (!current_value)
     {
       auto& r = results.emplace_back();
@@ -299,6 +475,16 @@ Cheats::NextSearch(const Core::CPUThreadGuard& guard,
   return results;
 }
 
+template <typename T>
+Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>
+Cheats::NextSearch(const Core::CPUThreadGuard& guard,
+                   const std::vector<Cheats::SearchResult<T>>& previous_results,
+                   PowerPC::RequestedAddressSpace address_space,
+                   const std::function<bool(const T& new_value, const T& old_value)>& validator)
+{
+  return NextSearchImpl<T>(guard, previous_results, address_space, validator);
+}
+
 Cheats::CheatSearchSessionBase::~CheatSearchSessionBase() = default;
 
 template <typename T>
@@ -374,51 +560,28 @@ void Cheats::CheatSearchSession<T>::ResetResults()
   m_search_results.clear();
 }
 
-template <typename T>
-static std::function<bool(const T& new_value)>
-MakeCompareFunctionForSpecificValue(Cheats::CompareType op, const T& old_value)
+// Calls f with the comparator for the given compare type. Unlike a std::function, the comparator
+// can be inlined into the search loops.
+template <typename T, typename F>
+static auto VisitCompareFunction(Cheats::CompareType op, F&& f) -> decltype(f(std::equal_to<T>()))
 {
   switch (op)
   {
   case Cheats::CompareType::Equal:
-    return [&](const T& new_value) { return new_value == old_value; };
+    return f(std::equal_to<T>());
   case Cheats::CompareType::NotEqual:
-    return [&](const T& new_value) { return new_value != old_value; };
+    return f(std::not_equal_to<T>());
   case Cheats::CompareType::Less:
-    return [&](const T& new_value) { return new_value < old_value; };
+    return f(std::less<T>());
   case Cheats::CompareType::LessOrEqual:
-    return [&](const T& new_value) { return new_value <= old_value; };
+    return f(std::less_equal<T>());
   case Cheats::CompareType::Greater:
-    return [&](const T& new_value) { return new_value > old_value; };
+    return f(std::greater<T>());
   case Cheats::CompareType::GreaterOrEqual:
-    return [&](const T& new_value) { return new_value >= old_value; };
+    return f(std::greater_equal<T>());
   default:
     DEBUG_ASSERT(false);
-    return nullptr;
-  }
-}
-
-template <typename T>
-static std::function<bool(const T& old_value, const T& new_value)>
-MakeCompareFunctionForLastValue(Cheats::CompareType op)
-{
-  switch (op)
-  {
-  case Cheats::CompareType::Equal:
-    return std::equal_to<T>();
-  case Cheats::CompareType::NotEqual:
-    return std::not_equal_to<T>();
-  case Cheats::CompareType::Less:
-    return std::less<T>();
-  case Cheats::CompareType::LessOrEqual:
-    return std::less_equal<T>();
-  case Cheats::CompareType::Greater:
-    return std::greater<T>();
-  case Cheats::CompareType::GreaterOrEqual:
-    return std::greater_equal<T>();
-  default:
-    DEBUG_ASSERT(false);
-    return nullptr;
+    return Cheats::SearchErrorCode::InvalidParameters;
   }
 }
 
@@ -434,37 +597,38 @@ Cheats::SearchErrorCode Cheats::CheatSearchSession<T>::RunSearch(const Core::CPU
     if (!m_value)
       return Cheats::SearchErrorCode::InvalidParameters;
 
-    auto func = MakeCompareFunctionForSpecificValue<T>(m_compare_type, *m_value);
-    if (m_first_search_done)
-    {
-      result = Cheats::NextSearch<T>(
-          guard, m_search_results, m_address_space,
-          [&func](const T& new_value, const T& old_value) { return func(new_value); });
-    }
-    else
-    {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned, func);
-    }
+    const T value = *m_value;
+    result = VisitCompareFunction<T>(m_compare_type, [&](auto compare) {
+      if (m_first_search_done)
+      {
+        return NextSearchImpl<T>(
+            guard, m_search_results, m_address_space,
+            [&](const T& new_value, const T& old_value) { return compare(new_value, value); });
+      }
+      return NewSearchImpl<T>(guard, m_memory_ranges, m_address_space, m_aligned,
+                              [&](const T& new_value) { return compare(new_value, value); });
+    });
   }
   else if (m_filter_type == FilterType::CompareAgainstLastValue)
   {
     if (!m_first_search_done)
       return Cheats::SearchErrorCode::InvalidParameters;
 
-    result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                   MakeCompareFunctionForLastValue<T>(m_compare_type));
+    result = VisitCompareFunction<T>(m_compare_type, [&](auto compare) {
+      return NextSearchImpl<T>(guard, m_search_results, m_address_space, compare);
+    });
   }
   else if (m_filter_type == FilterType::DoNotFilter)
   {
     if (m_first_search_done)
     {
-      result = Cheats::NextSearch<T>(guard, m_search_results, m_address_space,
-                                     [](const T& v1, const T& v2) { return true; });
+      result = NextSearchImpl<T>(guard, m_search_results, m_address_space,
+                                 [](const T& v1, const T& v2) { return true; });
     }
     else
     {
-      result = Cheats::NewSearch<T>(guard, m_memory_ranges, m_address_space, m_aligned,
-                                    [](const T& v) { return true; });
+      result = NewSearchImpl<T>(guard, m_memory_ranges, m_address_space, m_aligned,
+                                [](const T& v) { return true; });
     }
   }
 
@@ -621,6 +785,29 @@ Cheats::CheatSearchSession<T>::ClonePartial(const size_t begin_index, const size
   return c;
 }
 
+// RunSearch doesn't go through these, so they need to be instantiated explicitly.
+#define INSTANTIATE_SEARCH_FUNCTIONS(T)                                                            \
+  template Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>           \
+  Cheats::NewSearch(const Core::CPUThreadGuard&, const std::vector<Cheats::MemoryRange>&,          \
+                    PowerPC::RequestedAddressSpace, bool, const std::function<bool(const T&)>&);   \
+  template Common::Result<Cheats::SearchErrorCode, std::vector<Cheats::SearchResult<T>>>           \
+  Cheats::NextSearch(const Core::CPUThreadGuard&, const std::vector<Cheats::SearchResult<T>>&,     \
+                     PowerPC::RequestedAddressSpace,                                               \
+                     const std::function<bool(const T&, const T&)>&)
+
+INSTANTIATE_SEARCH_FUNCTIONS(u8);
+INSTANTIATE_SEARCH_FUNCTIONS(u16);
+INSTANTIATE_SEARCH_FUNCTIONS(u32);
+INSTANTIATE_SEARCH_FUNCTIONS(u64);
+INSTANTIATE_SEARCH_FUNCTIONS(s8);
+INSTANTIATE_SEARCH_FUNCTIONS(s16);
+INSTANTIATE_SEARCH_FUNCTIONS(s32);
+INSTANTIATE_SEARCH_FUNCTIONS(s64);
+INSTANTIATE_SEARCH_FUNCTIONS(float);
+INSTANTIATE_SEARCH_FUNCTIONS(double);
+
+#undef INSTANTIATE_SEARCH_FUNCTIONS
+
 template class Cheats::CheatSearchSession<u8>;
 template class Cheats::CheatSearchSession<u16>;
 template class Cheats::CheatSearchSession<u32>;
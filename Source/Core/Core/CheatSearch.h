@@ -113,7 +113,8 @@ DataType GetDataType(const SearchValue& value);
 std::vector<u8> GetValueAsByteVector(const SearchValue& value);
 
 // Do a new search across the given memory region in the given address space, only keeping values
-// for which the given validator returns true.
+// for which the given validator returns true. Large regions are scanned on several threads, so the
+// validator may be called concurrently.
 template <typename T>
 Common::Result<SearchErrorCode, std::vector<SearchResult<T>>>
 NewSearch(const Core::CPUThreadGuard& guard, const std::vector<MemoryRange>& memory_ranges,
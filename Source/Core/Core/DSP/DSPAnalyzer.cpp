@@ -60,6 +60,47 @@ constexpr u16 idle_skip_sigs[NUM_IDLE_SIGS][MAX_IDLE_SIG_SIZE + 1] = {
      0, 0},
 };
 
+// Longest mailbox polling loop body (not counting the mailbox read) that
+// FindMailboxPollingLoops will recognize.
+constexpr size_t MAX_POLLING_LOOP_INSTRUCTIONS = 4;
+
+// Whether the instruction reads the high half of one of the mailboxes, assuming $CR is 0xFF.
+static bool IsMailboxHighRead(const SDSP& dsp, u16 addr)
+{
+  const UDSPInstruction inst = dsp.ReadIMEM(addr);
+
+  // LRS $(D+24), @M
+  if ((inst & 0xf800) == 0x2000)
+    return (inst & 0xff) == DSP_DMBH || (inst & 0xff) == DSP_CMBH;
+
+  // LR $D, @M, but only into $ax/$ac. Loading into a stack register would push a
+  // value every iteration.
+  if ((inst & 0xffe0) == 0x00c0 && (inst & 0x1f) >= 0x18)
+  {
+    const u16 mem = dsp.ReadIMEM(static_cast<u16>(addr + 1));
+    return mem == (0xff00 | DSP_DMBH) || mem == (0xff00 | DSP_CMBH);
+  }
+
+  return false;
+}
+
+// Whether the instruction only updates $SR based on its operands. Extended
+// opcodes only qualify if their extension is a NOP.
+static bool IsFlagTest(UDSPInstruction inst)
+{
+  return (inst & 0xfeff) == 0x02a0 ||  // ANDF $acD.m, #I
+         (inst & 0xfeff) == 0x02c0 ||  // ANDCF $acD.m, #I
+         (inst & 0xfeff) == 0x0280 ||  // CMPI $acD.m, #I
+         (inst & 0xfeff) == 0x8600 ||  // TSTAXH $axR.h
+         (inst & 0xf7ff) == 0xb100;    // TST $acR
+}
+
+// Whether the instruction is a conditional Jcc.
+static bool IsConditionalJump(UDSPInstruction inst)
+{
+  return (inst & 0xfff0) == 0x0290 && inst != 0x029f;
+}
+
 Analyzer::Analyzer() = default;
 Analyzer::~Analyzer() = default;
 
@@ -83,6 +124,7 @@ void Analyzer::AnalyzeRange(const SDSP& dsp, u16 start_addr, u16 end_addr)
 
   // Next, we'll scan for potential idle skips.
   FindIdleSkips(dsp, start_addr, end_addr);
+  FindMailboxPollingLoops(dsp, start_addr, end_addr);
 
   INFO_LOG_FMT(DSPLLE, "Finished analysis.");
 }
@@ -170,4 +212,41 @@ void Analyzer::FindIdleSkips(const SDSP& dsp, u16 start_addr, u16 end_addr)
     }
   }
 }
+
+void Analyzer::FindMailboxPollingLoops(const SDSP& dsp, u16 start_addr, u16 end_addr)
+{
+  // Catches the mail wait loops that the hardcoded signatures above don't know about:
+  //
+  //   addr: LR/LRS $reg, @DMBH/@CMBH
+  //         <up to MAX_POLLING_LOOP_INSTRUCTIONS flag tests>
+  //         Jcc addr
+  //
+  // Until the CPU touches the mailbox, every iteration of such a loop leaves the
+  // DSP in exactly the same state, so it's safe to give up the time slice.
+  for (u16 addr = start_addr; addr < end_addr; addr++)
+  {
+    if (!IsStartOfInstruction(addr) || IsIdleSkip(addr) || !IsMailboxHighRead(dsp, addr))
+      continue;
+
+    u16 pc = static_cast<u16>(addr + GetOpTemplate(dsp.ReadIMEM(addr))->size);
+    for (size_t i = 0; i <= MAX_POLLING_LOOP_INSTRUCTIONS; i++)
+    {
+      const UDSPInstruction inst = dsp.ReadIMEM(pc);
+      if (IsConditionalJump(inst))
+      {
+        if (dsp.ReadIMEM(static_cast<u16>(pc + 1)) == addr)
+        {
+          INFO_LOG_FMT(DSPLLE, "Idle skip location found at {:02x} (mailbox polling loop)", addr);
+          m_code_flags[addr] |= CODE_IDLE_SKIP;
+        }
+        break;
+      }
+
+      if (!IsFlagTest(inst))
+        break;
+
+      pc = static_cast<u16>(pc + GetOpTemplate(inst)->size);
+    }
+  }
+}
 }  // namespace DSP
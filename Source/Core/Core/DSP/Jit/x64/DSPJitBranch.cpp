@@ -147,8 +147,10 @@ void DSPEmitter::r_jcc(const UDSPInstruction opc)
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
   const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
+  // Attempt to link directly to the destination block. Conditional branches only link to blocks
+  // that are already linkable: an unresolved jump would keep this block from becoming a link
+  // destination itself, just for the sake of a path that may rarely be taken.
+  if (opcode->uncond_branch || m_block_links[dest] != nullptr)
     WriteBlockLink(dest);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
@@ -194,8 +196,8 @@ void DSPEmitter::r_call(const UDSPInstruction opc)
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
   const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
+  // Same linking rules as r_jcc.
+  if (opcode->uncond_branch || m_block_links[dest] != nullptr)
     WriteBlockLink(dest);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
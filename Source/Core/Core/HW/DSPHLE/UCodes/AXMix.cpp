@@ -0,0 +1,201 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
+
+#include <algorithm>
+
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE
+{
+namespace
+{
+s16 ClampS16(s32 sample)
+{
+  return static_cast<s16>(std::clamp<s32>(sample, -0x8000, 0x7FFF));
+}
+
+template <bool SignedVolume>
+s16 ScaleSample(s16 sample, u16 volume)
+{
+  const s32 vol = SignedVolume ? static_cast<s16>(volume) : volume;
+  return ClampS16((s32(sample) * vol) >> 15);
+}
+
+#if defined(_M_X86_64)
+// Volume for each of the next 8 samples.
+__m128i VolumeRamp(u16 volume, u16 volume_delta)
+{
+  const __m128i steps = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm_add_epi16(_mm_set1_epi16(volume),
+                       _mm_mullo_epi16(_mm_set1_epi16(volume_delta), steps));
+}
+
+// Computes ClampS16((sample * volume) >> 15) for 8 samples at once.
+template <bool SignedVolume>
+__m128i ScaleSamples(__m128i samples, __m128i volumes)
+{
+  const __m128i lo = _mm_mullo_epi16(samples, volumes);
+  __m128i hi = _mm_mulhi_epi16(samples, volumes);
+  if (!SignedVolume)
+  {
+    // mulhi treats volumes >= 0x8000 as negative, which makes the high half of the product off
+    // by exactly the sample value.
+    hi = _mm_add_epi16(hi, _mm_and_si128(samples, _mm_srai_epi16(volumes, 15)));
+  }
+  const __m128i products_lo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 15);
+  const __m128i products_hi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 15);
+  return _mm_packs_epi32(products_lo, products_hi);
+}
+#elif defined(_M_ARM_64)
+int16x8_t VolumeRamp(u16 volume, u16 volume_delta)
+{
+  static constexpr s16 steps_array[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  const int16x8_t steps = vld1q_s16(steps_array);
+  return vmlaq_s16(vdupq_n_s16(static_cast<s16>(volume)), steps,
+                   vdupq_n_s16(static_cast<s16>(volume_delta)));
+}
+
+template <bool SignedVolume>
+int32x4_t WidenVolume(int16x4_t volumes)
+{
+  if (SignedVolume)
+    return vmovl_s16(volumes);
+  return vreinterpretq_s32_u32(vmovl_u16(vreinterpret_u16_s16(volumes)));
+}
+
+template <bool SignedVolume>
+int16x8_t ScaleSamples(int16x8_t samples, int16x8_t volumes)
+{
+  const int32x4_t products_lo = vmulq_s32(vmovl_s16(vget_low_s16(samples)),
+                                          WidenVolume<SignedVolume>(vget_low_s16(volumes)));
+  const int32x4_t products_hi = vmulq_s32(vmovl_s16(vget_high_s16(samples)),
+                                          WidenVolume<SignedVolume>(vget_high_s16(volumes)));
+  return vcombine_s16(vqshrn_n_s32(products_lo, 15), vqshrn_n_s32(products_hi, 15));
+}
+#endif
+
+template <bool SignedVolume>
+void ApplyVolumeEnvelopeImpl(s16* samples, u32 count, u16* volume, u16 volume_delta)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64)
+  __m128i volumes = VolumeRamp(*volume, volume_delta);
+  const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+    _mm_storeu_si128(ptr, ScaleSamples<SignedVolume>(_mm_loadu_si128(ptr), volumes));
+    volumes = _mm_add_epi16(volumes, volume_step);
+  }
+#elif defined(_M_ARM_64)
+  int16x8_t volumes = VolumeRamp(*volume, volume_delta);
+  const int16x8_t volume_step = vdupq_n_s16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    vst1q_s16(samples + i, ScaleSamples<SignedVolume>(vld1q_s16(samples + i), volumes));
+    volumes = vaddq_s16(volumes, volume_step);
+  }
+#endif
+
+  u16 vol = static_cast<u16>(*volume + volume_delta * i);
+  for (; i < count; ++i)
+  {
+    samples[i] = ScaleSample<SignedVolume>(samples[i], vol);
+    vol += volume_delta;
+  }
+  *volume = vol;
+}
+}  // namespace
+
+void MixAddSamplesScalar(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                         s16* dpop)
+{
+  u16 vol = *volume;
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s16 sample16 = ScaleSample<false>(input[i], vol);
+    out[i] += sample16;
+    vol += volume_delta;
+    *dpop = sample16;
+  }
+  *volume = vol;
+}
+
+void MixAddSamples(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                   s16* dpop)
+{
+  u32 i = 0;
+
+#if defined(_M_X86_64)
+  __m128i volumes = VolumeRamp(*volume, volume_delta);
+  const __m128i volume_step = _mm_set1_epi16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = ScaleSamples<false>(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), volumes);
+    volumes = _mm_add_epi16(volumes, volume_step);
+
+    // Sign-extend to 32 bits and accumulate.
+    __m128i* out_lo = reinterpret_cast<__m128i*>(out + i);
+    __m128i* out_hi = reinterpret_cast<__m128i*>(out + i + 4);
+    _mm_storeu_si128(out_lo,
+                     _mm_add_epi32(_mm_loadu_si128(out_lo),
+                                   _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16)));
+    _mm_storeu_si128(out_hi,
+                     _mm_add_epi32(_mm_loadu_si128(out_hi),
+                                   _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16)));
+
+    if (i + 8 == count)
+      *dpop = static_cast<s16>(_mm_extract_epi16(samples, 7));
+  }
+#elif defined(_M_ARM_64)
+  int16x8_t volumes = VolumeRamp(*volume, volume_delta);
+  const int16x8_t volume_step = vdupq_n_s16(static_cast<s16>(volume_delta * 8));
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t samples = ScaleSamples<false>(vld1q_s16(input + i), volumes);
+    volumes = vaddq_s16(volumes, volume_step);
+
+    vst1q_s32(out + i, vaddw_s16(vld1q_s32(out + i), vget_low_s16(samples)));
+    vst1q_s32(out + i + 4, vaddw_s16(vld1q_s32(out + i + 4), vget_high_s16(samples)));
+
+    if (i + 8 == count)
+      *dpop = vgetq_lane_s16(samples, 7);
+  }
+#endif
+
+  *volume = static_cast<u16>(*volume + volume_delta * i);
+  MixAddSamplesScalar(out + i, input + i, count - i, volume, volume_delta, dpop);
+}
+
+void ApplyVolumeEnvelopeScalar(s16* samples, u32 count, u16* volume, u16 volume_delta,
+                               bool signed_volume)
+{
+  u16 vol = *volume;
+  for (u32 i = 0; i < count; ++i)
+  {
+    samples[i] = signed_volume ? ScaleSample<true>(samples[i], vol) :
+                                 ScaleSample<false>(samples[i], vol);
+    vol += volume_delta;
+  }
+  *volume = vol;
+}
+
+void ApplyVolumeEnvelope(s16* samples, u32 count, u16* volume, u16 volume_delta,
+                         bool signed_volume)
+{
+  if (signed_volume)
+    ApplyVolumeEnvelopeImpl<true>(samples, count, volume, volume_delta);
+  else
+    ApplyVolumeEnvelopeImpl<false>(samples, count, volume, volume_delta);
+}
+}  // namespace DSP::HLE
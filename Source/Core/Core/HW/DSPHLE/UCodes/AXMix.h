@@ -0,0 +1,31 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Sample processing loops shared by the GC and Wii versions of AX.
+//
+// Every function has a plain C++ version (suffixed with Scalar) and a version that uses SSE2 on
+// x64 and NEON on AArch64. Both must always produce bit-identical results, since the output ends
+// up in the emulated DSP's mixing buffers.
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE
+{
+// Multiplies each sample by a 1.15 fixed point volume and adds the clamped result to out. The
+// volume is incremented by volume_delta (with 16-bit wraparound) after every sample. If count is
+// not zero, the last sample that was added is stored into dpop.
+void MixAddSamples(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                   s16* dpop);
+void MixAddSamplesScalar(int* out, const s16* input, u32 count, u16* volume, u16 volume_delta,
+                         s16* dpop);
+
+// Multiplies each sample in place by a 1.15 fixed point volume, incrementing the volume by
+// volume_delta (with 16-bit wraparound) after every sample. The GameCube version of AX treats the
+// volume as signed and the Wii version treats it as unsigned.
+void ApplyVolumeEnvelope(s16* samples, u32 count, u16* volume, u16 volume_delta,
+                         bool signed_volume);
+void ApplyVolumeEnvelopeScalar(s16* samples, u32 count, u16* volume, u16 volume_delta,
+                               bool signed_volume);
+}  // namespace DSP::HLE
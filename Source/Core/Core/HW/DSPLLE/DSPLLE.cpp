@@ -3,7 +3,6 @@
 
 #include "Core/HW/DSPLLE/DSPLLE.h"
 
-#include <mutex>
 #include <string>
 #include <thread>
 
@@ -50,7 +49,7 @@ void DSPLLE::DoState(PointerWrap& p)
     return;
   }
   m_dsp_core.DoState(p);
-  p.Do(m_cycle_count);
+  m_thread_sync.DoState(p);
 }
 
 // Regular thread
@@ -58,30 +57,12 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 {
   Common::SetCurrentThreadName("DSP thread");
 
-  while (dsp_lle->m_is_running.IsSet())
-  {
-    const int cycles = static_cast<int>(dsp_lle->m_cycle_count.load());
-    if (cycles > 0)
-    {
-      std::unique_lock dsp_thread_lock(dsp_lle->m_dsp_thread_mutex, std::try_to_lock);
-      if (dsp_thread_lock)
-      {
-        if (dsp_lle->m_dsp_core.IsJITCreated())
-        {
-          dsp_lle->m_dsp_core.RunCycles(cycles);
-        }
-        else
-        {
-          dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
-        }
-        dsp_lle->m_cycle_count.store(0);
-        continue;
-      }
-    }
-
-    dsp_lle->m_ppc_event.Set();
-    dsp_lle->m_dsp_event.Wait();
-  }
+  dsp_lle->m_thread_sync.RunThread([dsp_lle](int cycles) {
+    if (dsp_lle->m_dsp_core.IsJITCreated())
+      dsp_lle->m_dsp_core.RunCycles(cycles);
+    else
+      dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
+  });
 }
 
 static bool LoadDSPRom(u16* rom, const std::string& filename, u32 size_in_bytes)
@@ -150,6 +131,7 @@ bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 
   m_wii = wii;
   m_is_dsp_on_thread = dsp_thread;
+  m_max_slack_cycles = Config::Get(Config::MAIN_DSP_THREAD_SLACK);
 
   m_dsp_core.Reset();
 
@@ -157,7 +139,7 @@ bool DSPLLE::Initialize(bool wii, bool dsp_thread)
 
   if (dsp_thread)
   {
-    m_is_running.Set(true);
+    m_thread_sync.Start();
     m_dsp_thread = std::thread(DSPThread, this);
   }
 
@@ -170,9 +152,7 @@ void DSPLLE::DSP_StopSoundStream()
   if (!m_is_dsp_on_thread)
     return;
 
-  m_is_running.Clear();
-  m_ppc_event.Set();
-  m_dsp_event.Set();
+  m_thread_sync.Stop();
   m_dsp_thread.join();
 }
 
@@ -181,8 +161,15 @@ void DSPLLE::Shutdown()
   m_dsp_core.Shutdown();
 }
 
+// The DSP thread is allowed to lag behind the CPU, but control register and mailbox accesses are
+// the points where the two sides actually observe each other (reset, halt, interrupt acks, mail
+// polling), so let the DSP catch up before any of them.
+
 u16 DSPLLE::DSP_WriteControlRegister(u16 value)
 {
+  if (m_is_dsp_on_thread)
+    m_thread_sync.WaitForDSPThread(0);
+
   m_dsp_core.GetInterpreter().WriteControlRegister(value);
 
   if ((value & CR_EXTERNAL_INT) != 0)
@@ -207,16 +194,23 @@ u16 DSPLLE::DSP_WriteControlRegister(u16 value)
 
 u16 DSPLLE::DSP_ReadControlRegister()
 {
+  if (m_is_dsp_on_thread)
+    m_thread_sync.WaitForDSPThread(0);
+
   return m_dsp_core.GetInterpreter().ReadControlRegister();
 }
 
 u16 DSPLLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
+  if (m_is_dsp_on_thread)
+    m_thread_sync.WaitForDSPThread(0);
   return m_dsp_core.ReadMailboxHigh(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
 u16 DSPLLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
 {
+  if (m_is_dsp_on_thread)
+    m_thread_sync.WaitForDSPThread(0);
   return m_dsp_core.ReadMailboxLow(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
@@ -224,6 +218,9 @@ void DSPLLE::DSP_WriteMailBoxHigh(bool cpu_mailbox, u16 value)
 {
   if (cpu_mailbox)
   {
+    if (m_is_dsp_on_thread)
+      m_thread_sync.WaitForDSPThread(0);
+
     if ((m_dsp_core.PeekMailbox(Mailbox::CPU) & 0x80000000) != 0)
     {
       // the DSP didn't read the previous value
@@ -242,6 +239,9 @@ void DSPLLE::DSP_WriteMailBoxLow(bool cpu_mailbox, u16 value)
 {
   if (cpu_mailbox)
   {
+    if (m_is_dsp_on_thread)
+      m_thread_sync.WaitForDSPThread(0);
+
     m_dsp_core.WriteMailboxLow(Mailbox::CPU, value);
   }
   else
@@ -276,10 +276,9 @@ void DSPLLE::DSP_Update(int cycles)
   }
   else
   {
-    // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    m_ppc_event.Wait();
-    m_cycle_count.fetch_add(dsp_cycles);
-    m_dsp_event.Set();
+    // Let the DSP thread run behind the CPU by up to m_max_slack_cycles instead of waiting for
+    // it to go idle every time. Mailbox accesses still synchronize fully.
+    m_thread_sync.QueueCycles(static_cast<u32>(dsp_cycles), m_max_slack_cycles);
   }
 }
 
@@ -291,19 +290,8 @@ u32 DSPLLE::DSP_UpdateRate()
 void DSPLLE::PauseAndLock(bool do_lock)
 {
   if (do_lock)
-  {
-    m_dsp_thread_mutex.lock();
-  }
+    m_thread_sync.Lock();
   else
-  {
-    m_dsp_thread_mutex.unlock();
-
-    if (m_is_dsp_on_thread)
-    {
-      // Signal the DSP thread so it can perform any outstanding work now (if any)
-      m_ppc_event.Wait();
-      m_dsp_event.Set();
-    }
-  }
+    m_thread_sync.Unlock();
 }
 }  // namespace DSP::LLE
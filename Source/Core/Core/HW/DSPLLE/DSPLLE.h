@@ -3,14 +3,12 @@
 
 #pragma once
 
-#include <atomic>
-#include <mutex>
 #include <thread>
 
 #include "Common/CommonTypes.h"
-#include "Common/Flag.h"
 #include "Core/DSP/DSPCore.h"
 #include "Core/DSPEmulator.h"
+#include "Core/HW/DSPLLE/DSPThreadSync.h"
 
 class PointerWrap;
 
@@ -43,13 +41,11 @@ private:
 
   DSPCore m_dsp_core;
   std::thread m_dsp_thread;
-  std::mutex m_dsp_thread_mutex;
+  DSPThreadSync m_thread_sync;
   bool m_is_dsp_on_thread = false;
-  Common::Flag m_is_running;
-  std::atomic<u32> m_cycle_count{};
+  // How many DSP cycles the DSP thread may lag behind the CPU before DSP_Update blocks.
+  u32 m_max_slack_cycles = 0;
 
-  Common::Event m_dsp_event;
-  Common::Event m_ppc_event;
   bool m_request_disable_thread = false;
 };
 }  // namespace DSP::LLE
@@ -0,0 +1,82 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPLLE/DSPThreadSync.h"
+
+#include "Common/ChunkFile.h"
+
+namespace DSP::LLE
+{
+void DSPThreadSync::Start()
+{
+  m_is_running.Set(true);
+}
+
+void DSPThreadSync::Stop()
+{
+  m_is_running.Clear();
+  m_ppc_event.Set();
+  m_dsp_event.Set();
+}
+
+void DSPThreadSync::QueueCycles(u32 cycles, u32 max_pending_cycles)
+{
+  WaitForDSPThread(max_pending_cycles);
+  m_cycle_count.fetch_add(cycles);
+  m_dsp_event.Set();
+}
+
+void DSPThreadSync::WaitForDSPThread(u32 max_pending_cycles)
+{
+  // Both events are auto-reset and the DSP thread may have signalled m_ppc_event before an
+  // earlier wait consumed it. Kicking the DSP thread before every wait guarantees another signal
+  // is coming, whether it runs a slice or finds the lock taken and goes back to idle.
+  while (m_cycle_count.load() > max_pending_cycles && m_is_running.IsSet())
+  {
+    m_dsp_event.Set();
+    m_ppc_event.Wait();
+  }
+}
+
+void DSPThreadSync::Lock()
+{
+  m_mutex.lock();
+}
+
+void DSPThreadSync::Unlock()
+{
+  m_mutex.unlock();
+
+  // Let the DSP thread perform any outstanding work now (if any).
+  WaitForDSPThread(0);
+}
+
+void DSPThreadSync::DoState(PointerWrap& p)
+{
+  p.Do(m_cycle_count);
+}
+
+void DSPThreadSync::RunThread(const std::function<void(int)>& run_cycles)
+{
+  while (m_is_running.IsSet())
+  {
+    const int cycles = static_cast<int>(m_cycle_count.load());
+    if (cycles > 0)
+    {
+      std::unique_lock lock(m_mutex, std::try_to_lock);
+      if (lock)
+      {
+        run_cycles(cycles);
+        // The CPU thread may have queued more cycles in the meantime, so only subtract the ones
+        // that were actually run.
+        m_cycle_count.fetch_sub(static_cast<u32>(cycles));
+        m_ppc_event.Set();
+        continue;
+      }
+    }
+
+    m_ppc_event.Set();
+    m_dsp_event.Wait();
+  }
+}
+}  // namespace DSP::LLE
@@ -0,0 +1,54 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+#include "Common/CommonTypes.h"
+#include "Common/Event.h"
+#include "Common/Flag.h"
+
+class PointerWrap;
+
+namespace DSP::LLE
+{
+// Hands emulated DSP cycles from the CPU thread to the DSP thread. The CPU thread queues cycles
+// and can wait for the DSP thread to work them off; the DSP thread runs whatever is queued and
+// goes idle once nothing is left.
+class DSPThreadSync
+{
+public:
+  // NOTE: The methods below are called on the CPU thread.
+  void Start();
+  void Stop();
+
+  // Queues cycles for the DSP thread, after waiting until at most max_pending_cycles are queued.
+  void QueueCycles(u32 cycles, u32 max_pending_cycles);
+
+  // Blocks until the DSP thread has at most max_pending_cycles left to run.
+  void WaitForDSPThread(u32 max_pending_cycles);
+
+  // Keeps the DSP thread from running while locked. Unlock lets it catch up on any cycles that
+  // were queued in the meantime before returning.
+  void Lock();
+  void Unlock();
+
+  void DoState(PointerWrap& p);
+
+  // Called on the DSP thread. Passes queued cycles to run_cycles until Stop is called.
+  void RunThread(const std::function<void(int)>& run_cycles);
+
+private:
+  std::mutex m_mutex;
+  Common::Flag m_is_running;
+  std::atomic<u32> m_cycle_count{};
+
+  // Set by the CPU thread when there is new work.
+  Common::Event m_dsp_event;
+  // Set by the DSP thread after each slice it runs and before it goes idle.
+  Common::Event m_ppc_event;
+};
+}  // namespace DSP::LLE
@@ -3,9 +3,11 @@
 
 #include "Core/HW/GPFifo.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
+#include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
@@ -18,6 +20,13 @@
 
 namespace GPFifo
 {
+u32 GetContiguousBurstCount(u32 write_pointer, u32 fifo_end, u32 burst_count)
+{
+  if (write_pointer > fifo_end)
+    return std::min<u32>(burst_count, 1);
+  return std::min<u32>(burst_count, (fifo_end - write_pointer) / GATHER_PIPE_SIZE + 1);
+}
+
 GPFifoManager::GPFifoManager(Core::System& system) : m_system(system)
 {
 }
@@ -87,23 +96,42 @@ void GPFifoManager::UpdateGatherPipe()
   auto& system = m_system;
   auto& memory = system.GetMemory();
   auto& processor_interface = system.GetProcessorInterface();
+  auto& command_processor = system.GetCommandProcessor();
 
   size_t pipe_count = GetGatherPipeCount();
-  size_t processed;
-  for (processed = 0; pipe_count >= GATHER_PIPE_SIZE; processed += GATHER_PIPE_SIZE)
+  size_t processed = 0;
+  while (pipe_count >= GATHER_PIPE_SIZE)
   {
-    // copy the GatherPipe
-    memory.CopyToEmu(processor_interface.m_fifo_cpu_write_pointer, m_gather_pipe + processed,
-                     GATHER_PIPE_SIZE);
-    pipe_count -= GATHER_PIPE_SIZE;
-
-    // increase the CPUWritePointer
-    if (processor_interface.m_fifo_cpu_write_pointer == processor_interface.m_fifo_cpu_end)
-      processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
-    else
-      processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
+    // Copy all bursts which are contiguous in guest memory at once, rather than one at a time.
+    // That's only possible if the command processor won't point the FIFO elsewhere in between.
+    const u32 write_pointer = processor_interface.m_fifo_cpu_write_pointer;
+    u32 bursts = 1;
+    if (command_processor.CanBatchGatherPipeBursts())
+    {
+      bursts = GetContiguousBurstCount(write_pointer, processor_interface.m_fifo_cpu_end,
+                                       static_cast<u32>(pipe_count / GATHER_PIPE_SIZE));
+    }
 
-    system.GetCommandProcessor().GatherPipeBursted();
+    // copy the GatherPipe
+    memory.CopyToEmu(write_pointer, m_gather_pipe + processed, bursts * GATHER_PIPE_SIZE);
+    processed += bursts * GATHER_PIPE_SIZE;
+    pipe_count -= bursts * GATHER_PIPE_SIZE;
+
+    // The command processor has to see each burst individually, so that the FIFO distance and
+    // watermarks are updated the same way as on hardware.
+    for (u32 i = 0; i < bursts; ++i)
+    {
+      // increase the CPUWritePointer
+      if (processor_interface.m_fifo_cpu_write_pointer == processor_interface.m_fifo_cpu_end)
+        processor_interface.m_fifo_cpu_write_pointer = processor_interface.m_fifo_cpu_base;
+      else
+        processor_interface.m_fifo_cpu_write_pointer += GATHER_PIPE_SIZE;
+
+      [[maybe_unused]] const u32 next_write_pointer = processor_interface.m_fifo_cpu_write_pointer;
+      command_processor.GatherPipeBursted();
+      DEBUG_ASSERT(i + 1 == bursts ||
+                   processor_interface.m_fifo_cpu_write_pointer == next_write_pointer);
+    }
   }
 
   // move back the spill bytes
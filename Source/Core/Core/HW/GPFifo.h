@@ -21,6 +21,10 @@ constexpr u32 GATHER_PIPE_PHYSICAL_ADDRESS = 0x0C008000;
 constexpr u32 GATHER_PIPE_SIZE = 32;
 constexpr u32 GATHER_PIPE_EXTRA_SIZE = GATHER_PIPE_SIZE * 16;
 
+// Returns how many of burst_count bursts can be copied to the FIFO at once, starting at
+// write_pointer. The FIFO wraps around to its base after the burst written to its end address.
+u32 GetContiguousBurstCount(u32 write_pointer, u32 fifo_end, u32 burst_count);
+
 class GPFifoManager final
 {
 public:
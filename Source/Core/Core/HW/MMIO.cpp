@@ -3,14 +3,28 @@
 
 #include "Core/HW/MMIO.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <vector>
 
 #include "Common/Assert.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Core/HW/MMIOHandlers.h"
 
 namespace MMIO
 {
+#if defined(_DEBUG) || defined(DEBUGFAST)
+// Number of accesses that went through a Complex handler, indexed by UniqueID.
+static std::array<std::atomic<u32>, NUM_MMIOS> s_complex_read_counts;
+static std::array<std::atomic<u32>, NUM_MMIOS> s_complex_write_counts;
+#endif
+
 // Base classes for the two handling method hierarchies. Note that a single
 // class can inherit from both.
 //
@@ -113,12 +127,12 @@ class ComplexHandlingMethod : public ReadHandlingMethod<T>, public WriteHandling
 {
 public:
   explicit ComplexHandlingMethod(std::function<T(Core::System&, u32)> read_lambda)
-      : read_lambda_(read_lambda), write_lambda_(InvalidWriteLambda())
+      : read_lambda_(CountReads(std::move(read_lambda))), write_lambda_(InvalidWriteLambda())
   {
   }
 
   explicit ComplexHandlingMethod(std::function<void(Core::System&, u32, T)> write_lambda)
-      : read_lambda_(InvalidReadLambda()), write_lambda_(write_lambda)
+      : read_lambda_(InvalidReadLambda()), write_lambda_(CountWrites(std::move(write_lambda)))
   {
   }
 
@@ -153,6 +167,32 @@ private:
     };
   }
 
+  static std::function<T(Core::System&, u32)>
+  CountReads(std::function<T(Core::System&, u32)> lambda)
+  {
+#if defined(_DEBUG) || defined(DEBUGFAST)
+    return [lambda = std::move(lambda)](Core::System& system, u32 addr) {
+      s_complex_read_counts[UniqueID(addr)].fetch_add(1, std::memory_order_relaxed);
+      return lambda(system, addr);
+    };
+#else
+    return lambda;
+#endif
+  }
+
+  static std::function<void(Core::System&, u32, T)>
+  CountWrites(std::function<void(Core::System&, u32, T)> lambda)
+  {
+#if defined(_DEBUG) || defined(DEBUGFAST)
+    return [lambda = std::move(lambda)](Core::System& system, u32 addr, T val) {
+      s_complex_write_counts[UniqueID(addr)].fetch_add(1, std::memory_order_relaxed);
+      lambda(system, addr, val);
+    };
+#else
+    return lambda;
+#endif
+  }
+
   std::function<T(Core::System&, u32)> read_lambda_;
   std::function<void(Core::System&, u32, T)> write_lambda_;
 };
@@ -220,15 +260,104 @@ struct LargerAccessSize<u16>
   typedef u32 value;
 };
 
+// Records which handling method a handler uses, so that the converters can be turned into simpler
+// handling methods when the underlying handlers allow it. This matters most for the JIT, which
+// can inline Constant and Direct accesses but has to call into C++ for Complex ones.
+template <typename T>
+struct ReadMethodInspector : public ReadHandlingMethodVisitor<T>
+{
+  enum class Kind
+  {
+    Constant,
+    Direct,
+    Complex,
+  };
+
+  void VisitConstant(T v) override
+  {
+    kind = Kind::Constant;
+    value = v;
+  }
+
+  void VisitDirect(const T* a, u32 m) override
+  {
+    kind = Kind::Direct;
+    addr = a;
+    mask = m;
+  }
+
+  void VisitComplex(const std::function<T(Core::System&, u32)>*) override { kind = Kind::Complex; }
+
+  Kind kind = Kind::Complex;
+  T value = 0;
+  const T* addr = nullptr;
+  u32 mask = 0;
+};
+
+template <typename T>
+struct WriteMethodInspector : public WriteHandlingMethodVisitor<T>
+{
+  enum class Kind
+  {
+    Nop,
+    Direct,
+    Complex,
+  };
+
+  void VisitNop() override { kind = Kind::Nop; }
+
+  void VisitDirect(T* a, u32 m) override
+  {
+    kind = Kind::Direct;
+    addr = a;
+    mask = m;
+  }
+
+  void VisitComplex(const std::function<void(Core::System&, u32, T)>*) override
+  {
+    kind = Kind::Complex;
+  }
+
+  Kind kind = Kind::Complex;
+  T* addr = nullptr;
+  u32 mask = 0;
+};
+
+// Checks whether two Direct handlers of the smaller size ST access the high and low halves of a
+// single value of the larger size T in host memory.
+template <typename T, typename ST>
+bool AreHalvesOf(const ST* high_part, const ST* low_part)
+{
+  static_assert(std::endian::native == std::endian::little);
+  return high_part == low_part + 1 && reinterpret_cast<uintptr_t>(low_part) % alignof(T) == 0;
+}
+
 template <typename T>
 ReadHandlingMethod<T>* ReadToSmaller(Mapping* mmio, u32 high_part_addr, u32 low_part_addr)
 {
   typedef typename SmallerAccessSize<T>::value ST;
+  constexpr u32 st_mask = std::numeric_limits<ST>::max();
+  constexpr u32 st_bits = 8 * sizeof(ST);
 
   ReadHandler<ST>* high_part = &mmio->GetHandlerForRead<ST>(high_part_addr);
   ReadHandler<ST>* low_part = &mmio->GetHandlerForRead<ST>(low_part_addr);
 
-  // TODO(delroth): optimize
+  ReadMethodInspector<ST> high_method;
+  ReadMethodInspector<ST> low_method;
+  high_part->Visit(high_method);
+  low_part->Visit(low_method);
+  using Kind = typename ReadMethodInspector<ST>::Kind;
+
+  if (high_method.kind == Kind::Constant && low_method.kind == Kind::Constant)
+    return Constant<T>(static_cast<T>((T(high_method.value) << st_bits) | low_method.value));
+
+  if (high_method.kind == Kind::Direct && low_method.kind == Kind::Direct &&
+      AreHalvesOf<T>(high_method.addr, low_method.addr))
+  {
+    const u32 mask = ((high_method.mask & st_mask) << st_bits) | (low_method.mask & st_mask);
+    return DirectRead<T>(reinterpret_cast<const T*>(low_method.addr), mask);
+  }
+
   return ComplexRead<T>([=](Core::System& system, u32 addr) {
     return ((T)high_part->Read(system, high_part_addr) << (8 * sizeof(ST))) |
            low_part->Read(system, low_part_addr);
@@ -243,7 +372,24 @@ WriteHandlingMethod<T>* WriteToSmaller(Mapping* mmio, u32 high_part_addr, u32 lo
   WriteHandler<ST>* high_part = &mmio->GetHandlerForWrite<ST>(high_part_addr);
   WriteHandler<ST>* low_part = &mmio->GetHandlerForWrite<ST>(low_part_addr);
 
-  // TODO(delroth): optimize
+  WriteMethodInspector<ST> high_method;
+  WriteMethodInspector<ST> low_method;
+  high_part->Visit(high_method);
+  low_part->Visit(low_method);
+  using Kind = typename WriteMethodInspector<ST>::Kind;
+
+  if (high_method.kind == Kind::Nop && low_method.kind == Kind::Nop)
+    return Nop<T>();
+
+  if (high_method.kind == Kind::Direct && low_method.kind == Kind::Direct &&
+      AreHalvesOf<T>(high_method.addr, low_method.addr))
+  {
+    constexpr u32 st_mask = std::numeric_limits<ST>::max();
+    constexpr u32 st_bits = 8 * sizeof(ST);
+    const u32 mask = ((high_method.mask & st_mask) << st_bits) | (low_method.mask & st_mask);
+    return DirectWrite<T>(reinterpret_cast<T*>(low_method.addr), mask);
+  }
+
   return ComplexWrite<T>([=](Core::System& system, u32 addr, T val) {
     high_part->Write(system, high_part_addr, val >> (8 * sizeof(ST)));
     low_part->Write(system, low_part_addr, (ST)val);
@@ -257,12 +403,60 @@ ReadHandlingMethod<T>* ReadToLarger(Mapping* mmio, u32 larger_addr, u32 shift)
 
   ReadHandler<LT>* large = &mmio->GetHandlerForRead<LT>(larger_addr);
 
-  // TODO(delroth): optimize
+  ReadMethodInspector<LT> large_method;
+  large->Visit(large_method);
+  using Kind = typename ReadMethodInspector<LT>::Kind;
+
+  if (large_method.kind == Kind::Constant)
+    return Constant<T>(static_cast<T>(large_method.value >> shift));
+
+  // Reading one half of a Direct value can be done by reading that half directly.
+  if (large_method.kind == Kind::Direct && (shift == 0 || shift == 8 * sizeof(T)))
+  {
+    static_assert(std::endian::native == std::endian::little);
+    const T* addr = reinterpret_cast<const T*>(large_method.addr) + (shift == 0 ? 0 : 1);
+    return DirectRead<T>(addr, (large_method.mask >> shift) & std::numeric_limits<T>::max());
+  }
+
   return ComplexRead<T>([large, shift](Core::System& system, u32 addr) {
     return large->Read(system, addr & ~(sizeof(LT) - 1)) >> shift;
   });
 }
 
+void LogComplexAccessCounts()
+{
+#if defined(_DEBUG) || defined(DEBUGFAST)
+  struct AccessCount
+  {
+    u32 id;
+    u32 reads;
+    u32 writes;
+  };
+
+  std::vector<AccessCount> counts;
+  for (u32 id = 0; id < NUM_MMIOS; ++id)
+  {
+    const u32 reads = s_complex_read_counts[id].exchange(0, std::memory_order_relaxed);
+    const u32 writes = s_complex_write_counts[id].exchange(0, std::memory_order_relaxed);
+    if (reads != 0 || writes != 0)
+      counts.push_back({id, reads, writes});
+  }
+
+  const auto total = [](const AccessCount& count) { return u64{count.reads} + count.writes; };
+  std::sort(counts.begin(), counts.end(),
+            [&](const AccessCount& a, const AccessCount& b) { return total(a) > total(b); });
+
+  constexpr size_t MAX_LOGGED_REGISTERS = 16;
+  counts.resize(std::min(counts.size(), MAX_LOGGED_REGISTERS));
+  for (const AccessCount& count : counts)
+  {
+    const u32 address = (count.id >= BLOCK_SIZE ? 0x0D000000 : 0x0C000000) | (count.id & 0xFFFF);
+    INFO_LOG_FMT(MEMMAP, "MMIO {:08x}: {} complex reads, {} complex writes", address,
+                 count.reads, count.writes);
+  }
+#endif
+}
+
 // Inplementation of the ReadHandler and WriteHandler class. There is a lot of
 // redundant code between these two classes but trying to abstract it away
 // brings more trouble than it fixes.
@@ -77,6 +77,11 @@ inline u32 UniqueID(u32 address)
   return (((address >> 24) & 1) << 16) | (address & 0xFFFF);
 }
 
+// Logs the MMIO registers that were accessed through Complex handlers most often since the last
+// call. These are the registers whose side effects make every access go through C++, so they are
+// the candidates for a faster path. Accesses are only counted in debug builds.
+void LogComplexAccessCounts();
+
 // Some utilities functions to define MMIO mappings.
 namespace Utils
 {
@@ -80,7 +80,9 @@ WriteHandlingMethod<T>* InvalidWrite();
 // Internally, these size conversion functions have some magic to make the
 // combined handlers as fast as possible. For example, if the two underlying
 // u16 handlers for a u32 reads are Direct to consecutive memory addresses,
-// they can be transformed into a Direct u32 access.
+// they can be transformed into a Direct u32 access. Since that decision is made
+// when the converter is created, the underlying handlers must already be
+// registered at that point.
 //
 // Warning: unlike the other handling methods, *ToSmaller are obviously not
 // available for u8, and *ToLarger are not available for u32.
@@ -15,6 +15,10 @@
 #include <span>
 #include <tuple>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -228,6 +232,13 @@ bool MemoryManager::InitFastmemArena()
     }
   }
 
+#ifdef _WIN32
+  // Views on Windows have to be aligned to the 64 KiB allocation granularity.
+  m_can_map_hardware_pages = false;
+#else
+  m_can_map_hardware_pages = sysconf(_SC_PAGESIZE) == static_cast<long>(PowerPC::HW_PAGE_SIZE);
+#endif
+
   m_is_fastmem_arena_initialized = true;
   m_fastmem_arena_size = memory_size;
   return true;
@@ -235,6 +246,9 @@ bool MemoryManager::InitFastmemArena()
 
 void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // The new BAT mappings may overlap pages that were mapped through the page table.
+  UnmapPageTableTranslations();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -290,6 +304,57 @@ void MemoryManager::UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+bool MemoryManager::MapPageTableTranslation(u32 logical_address, u32 physical_address)
+{
+  if (!m_is_fastmem_arena_initialized || !m_can_map_hardware_pages)
+    return false;
+
+  logical_address &= ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+  physical_address &= ~static_cast<u32>(PowerPC::HW_PAGE_MASK);
+
+  // If the page is already mapped, whatever faulted wasn't caused by a missing mapping.
+  if (m_page_table_mapped_entries.contains(logical_address))
+    return false;
+
+  for (const auto& physical_region : m_physical_regions)
+  {
+    if (!physical_region.active || physical_address < physical_region.physical_address ||
+        physical_address - physical_region.physical_address >= physical_region.size)
+    {
+      continue;
+    }
+
+    const u32 position =
+        physical_region.shm_position + physical_address - physical_region.physical_address;
+    u8* base = m_logical_base + logical_address;
+    void* mapped_pointer = m_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE, base);
+    if (!mapped_pointer)
+      return false;
+
+    m_page_table_mapped_entries.emplace(logical_address, mapped_pointer);
+    return true;
+  }
+
+  return false;
+}
+
+void MemoryManager::UnmapPageTableTranslations()
+{
+  for (const auto& entry : m_page_table_mapped_entries)
+    m_arena.UnmapFromMemoryRegion(entry.second, PowerPC::HW_PAGE_SIZE);
+  m_page_table_mapped_entries.clear();
+}
+
+void MemoryManager::UnmapPageTableTranslations(u32 tlb_set)
+{
+  std::erase_if(m_page_table_mapped_entries, [&](const auto& entry) {
+    if (((entry.first >> PowerPC::HW_PAGE_INDEX_SHIFT) & PowerPC::HW_PAGE_INDEX_MASK) != tlb_set)
+      return false;
+    m_arena.UnmapFromMemoryRegion(entry.second, PowerPC::HW_PAGE_SIZE);
+    return true;
+  });
+}
+
 void MemoryManager::DoState(PointerWrap& p)
 {
   const u32 current_ram_size = GetRamSize();
@@ -353,6 +418,7 @@ void MemoryManager::Shutdown()
     *region.out_pointer = nullptr;
   }
   m_arena.ReleaseSHMSegment();
+  MMIO::LogComplexAccessCounts();
   m_mmio_mapping.reset();
   INFO_LOG_FMT(MEMMAP, "Memory system shut down.");
 }
@@ -371,6 +437,8 @@ void MemoryManager::ShutdownFastmemArena()
     m_arena.UnmapFromMemoryRegion(base, region.size);
   }
 
+  UnmapPageTableTranslations();
+
   for (auto& entry : m_logical_mapped_entries)
   {
     m_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <memory>
 #include <span>
 #include <string>
@@ -101,6 +102,15 @@ public:
 
   void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+  // Maps a single 4 KiB page that the page table translates from logical_address to
+  // physical_address into the logical fastmem view. Returns false if the page couldn't be mapped,
+  // for instance because the host's page size is larger than the emulated one.
+  bool MapPageTableTranslation(u32 logical_address, u32 physical_address);
+  // Removes mappings made by MapPageTableTranslation, either all of them or only those for pages
+  // that fall into the given TLB set.
+  void UnmapPageTableTranslations();
+  void UnmapPageTableTranslations(u32 tlb_set);
+
   void Clear();
 
   // Routines to access physically addressed memory, designed for use by
@@ -249,6 +259,10 @@ private:
 
   std::vector<LogicalMemoryView> m_logical_mapped_entries;
 
+  // Page table translated pages in the logical view, keyed by logical address.
+  std::map<u32, void*> m_page_table_mapped_entries;
+  bool m_can_map_hardware_pages = false;
+
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_physical_page_mappings{};
   std::array<void*, PowerPC::BAT_PAGE_COUNT> m_logical_page_mappings{};
 
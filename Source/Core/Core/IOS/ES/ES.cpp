@@ -515,6 +515,8 @@ void ESDevice::DoState(PointerWrap& p)
     p.Do(entry.m_content);
     p.Do(entry.m_fd);
     p.Do(entry.m_uid);
+    if (p.IsReadMode())
+      entry.m_data.reset();
   }
 
   m_core.m_title_context.DoState(p);
@@ -4,7 +4,9 @@
 #pragma once
 
 #include <array>
+#include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -214,13 +216,32 @@ private:
     u64 m_title_id = 0;
     ES::Content m_content{};
     u32 m_uid = 0;
+    // Contents of the file, if it is in the content cache. Not savestated.
+    std::shared_ptr<const std::vector<u8>> m_data;
   };
 
+  struct CachedContent
+  {
+    u64 title_id = 0;
+    ES::Content content{};
+    std::shared_ptr<const std::vector<u8>> data;
+  };
+
+  // Returns the contents of a title content file, reading them into the cache if necessary.
+  // Returns nullptr if the content is too large to be cached or cannot be read.
+  std::shared_ptr<const std::vector<u8>> GetCachedContent(u64 title_id, const ES::Content& content,
+                                                          const std::string& path);
+
   Kernel& m_ios;
 
   using ContentTable = std::array<OpenedContent, 16>;
   ContentTable m_content_table;
 
+  // Recently opened contents, most recently used first. Titles such as the System Menu
+  // open and read the same contents over and over again.
+  std::list<CachedContent> m_content_cache;
+  u64 m_content_cache_size = 0;
+
   TitleContext m_title_context{};
 
   friend class ESDevice;
@@ -3,6 +3,7 @@
 
 #include "Core/IOS/ES/ES.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "Common/Logging/Log.h"
@@ -14,6 +15,48 @@
 
 namespace IOS::HLE
 {
+constexpr u64 MAX_CACHED_CONTENT_SIZE = 16 * 1024 * 1024;
+constexpr u64 MAX_CONTENT_CACHE_SIZE = 64 * 1024 * 1024;
+
+std::shared_ptr<const std::vector<u8>>
+ESCore::GetCachedContent(u64 title_id, const ES::Content& content, const std::string& path)
+{
+  const auto it =
+      std::find_if(m_content_cache.begin(), m_content_cache.end(), [&](const CachedContent& c) {
+        return c.title_id == title_id && c.content == content;
+      });
+  if (it != m_content_cache.end())
+  {
+    m_content_cache.splice(m_content_cache.begin(), m_content_cache, it);
+    return it->data;
+  }
+
+  if (content.size > MAX_CACHED_CONTENT_SIZE)
+    return nullptr;
+
+  // This is not an emulated read: timing is accounted for by the FS reads that are emulated
+  // when the content is read.
+  const auto file = m_ios.GetFS()->OpenFile(PID_KERNEL, PID_KERNEL, path, FS::Mode::Read);
+  if (!file)
+    return nullptr;
+  const auto status = file->GetStatus();
+  if (!status || status->size > MAX_CACHED_CONTENT_SIZE)
+    return nullptr;
+  auto data = std::make_shared<std::vector<u8>>(status->size);
+  const auto read_size = file->Read(data->data(), data->size());
+  if (!read_size || *read_size != data->size())
+    return nullptr;
+
+  m_content_cache_size += data->size();
+  m_content_cache.push_front({title_id, content, std::move(data)});
+  while (m_content_cache_size > MAX_CONTENT_CACHE_SIZE)
+  {
+    m_content_cache_size -= m_content_cache.back().data->size();
+    m_content_cache.pop_back();
+  }
+  return m_content_cache.front().data;
+}
+
 s32 ESCore::OpenContent(const ES::TMDReader& tmd, u16 content_index, u32 uid, Ticks ticks)
 {
   const u64 title_id = tmd.GetTitleId();
@@ -38,6 +81,7 @@ s32 ESCore::OpenContent(const ES::TMDReader& tmd, u16 content_index, u32 uid, Ti
     entry.m_content = content;
     entry.m_title_id = title_id;
     entry.m_uid = uid;
+    entry.m_data = GetCachedContent(title_id, content, path);
     INFO_LOG_FMT(IOS_ES,
                  "OpenContent: title ID {:016x}, UID {:#x}, content {:08x} (index {}) -> CFD {}",
                  title_id, uid, content.id, content_index, i);
@@ -105,6 +149,8 @@ s32 ESCore::ReadContent(u32 cfd, u8* buffer, u32 size, u32 uid, Ticks ticks)
   if (!entry.m_opened)
     return IPC_EINVAL;
 
+  if (entry.m_data)
+    return m_ios.GetFSCore().ReadFromBuffer(entry.m_fd, *entry.m_data, buffer, size, ticks);
   return m_ios.GetFSCore().Read(entry.m_fd, buffer, size, {}, ticks);
 }
 
@@ -109,7 +109,7 @@ void FSDevice::DoState(PointerWrap& p)
   p.Do(m_core.m_cache_chain_index);
   p.Do(m_core.m_cache_fd);
   p.Do(m_core.m_next_fd);
-  p.Do(m_core.m_fd_map);
+  p.Do(m_core.m_handles);
 }
 
 template <typename... Args>
@@ -183,7 +183,7 @@ FSCore::ScopedFd FSCore::Open(FS::Uid uid, FS::Gid gid, const std::string& path,
 {
   ticks.Add(IPC_OVERHEAD_TICKS);
 
-  if (m_fd_map.size() >= 16)
+  if (std::all_of(m_handles.begin(), m_handles.end(), [](const Handle& h) { return h.opened; }))
     return {this, ConvertResult(ResultCode::NoFreeHandle), ticks};
 
   if (path.size() >= 64)
@@ -193,7 +193,7 @@ FSCore::ScopedFd FSCore::Open(FS::Uid uid, FS::Gid gid, const std::string& path,
 
   if (path == "/dev/fs")
   {
-    m_fd_map[fd] = {gid, uid, INVALID_FD};
+    *AllocateHandle(fd) = {true, fd, gid, uid, INVALID_FD};
     return {this, static_cast<s64>(fd), ticks};
   }
 
@@ -204,11 +204,28 @@ FSCore::ScopedFd FSCore::Open(FS::Uid uid, FS::Gid gid, const std::string& path,
   if (!backend_fd)
     return {this, ConvertResult(backend_fd.Error()), ticks};
 
-  auto& handle = m_fd_map[fd] = {gid, uid, backend_fd->Release()};
+  Handle& handle = *AllocateHandle(fd) = {true, fd, gid, uid, backend_fd->Release()};
   std::strncpy(handle.name.data(), path.c_str(), handle.name.size());
   return {this, static_cast<s64>(fd), ticks};
 }
 
+FSCore::Handle* FSCore::FindHandle(u64 fd)
+{
+  const auto it = std::find_if(m_handles.begin(), m_handles.end(), [fd](const Handle& handle) {
+    return handle.opened && handle.fd == fd;
+  });
+  return it != m_handles.end() ? &*it : nullptr;
+}
+
+FSCore::Handle* FSCore::AllocateHandle(u64 fd)
+{
+  if (Handle* handle = FindHandle(fd))
+    return handle;
+  const auto it = std::find_if(m_handles.begin(), m_handles.end(),
+                               [](const Handle& handle) { return !handle.opened; });
+  return it != m_handles.end() ? &*it : nullptr;
+}
+
 std::optional<IPCReply> FSDevice::Close(u32 fd)
 {
   return MakeIPCReply([&](Ticks t) { return m_core.Close(static_cast<u64>(fd), t); });
@@ -218,8 +235,8 @@ s32 FSCore::Close(u64 fd, Ticks ticks)
 {
   ticks.Add(IPC_OVERHEAD_TICKS);
 
-  const auto& handle = m_fd_map[fd];
-  if (handle.fs_fd != INVALID_FD)
+  Handle* handle = FindHandle(fd);
+  if (handle && handle->fs_fd != INVALID_FD)
   {
     if (fd == m_cache_fd)
     {
@@ -227,18 +244,18 @@ s32 FSCore::Close(u64 fd, Ticks ticks)
       m_cache_fd.reset();
     }
 
-    if (handle.superblock_flush_needed)
+    if (handle->superblock_flush_needed)
       ticks.Add(GetSuperblockWriteTbTicks(m_ios.GetVersion()));
 
-    const ResultCode result = m_ios.GetFS()->Close(handle.fs_fd);
-    LogResult(result, "Close({})", handle.name.data());
-    m_fd_map.erase(fd);
+    const ResultCode result = m_ios.GetFS()->Close(handle->fs_fd);
+    LogResult(result, "Close({})", handle->name.data());
+    *handle = {};
     if (result != ResultCode::Success)
       return ConvertResult(result);
   }
-  else
+  else if (handle)
   {
-    m_fd_map.erase(fd);
+    *handle = {};
   }
   return IPC_SUCCESS;
 }
@@ -262,14 +279,15 @@ u64 FSCore::SimulateFlushFileCache()
   if (!m_cache_fd.has_value() || !m_dirty_cache)
     return 0;
   m_dirty_cache = false;
-  m_fd_map[*m_cache_fd].superblock_flush_needed = true;
+  if (Handle* handle = FindHandle(*m_cache_fd))
+    handle->superblock_flush_needed = true;
   return GetClusterWriteTbTicks(m_ios.GetVersion());
 }
 
 // Simulate parts of the FS read/write logic to estimate ticks for file operations correctly.
-u64 FSCore::EstimateTicksForReadWrite(const Handle& handle, u64 fd, IPCCommandType command,
-                                      u32 size)
+u64 FSCore::EstimateTicksForReadWrite(Handle& handle, IPCCommandType command, u32 size)
 {
+  const u64 fd = handle.fd;
   u64 ticks = 0;
 
   const bool is_write = command == IPC_CMD_WRITE;
@@ -289,7 +307,7 @@ u64 FSCore::EstimateTicksForReadWrite(const Handle& handle, u64 fd, IPCCommandTy
       ticks += (is_write ? GetClusterWriteTbTicks : GetClusterReadTbTicks)(m_ios.GetVersion());
       copy_length = CLUSTER_DATA_SIZE;
       if (is_write)
-        m_fd_map[fd].superblock_flush_needed = true;
+        handle.superblock_flush_needed = true;
     }
     else
     {
@@ -335,16 +353,16 @@ s32 FSCore::Read(u64 fd, u8* data, u32 size, std::optional<u32> ipc_buffer_addr,
 {
   ticks.Add(IPC_OVERHEAD_TICKS);
 
-  const Handle& handle = m_fd_map[fd];
-  if (handle.fs_fd == INVALID_FD)
+  Handle* handle = FindHandle(fd);
+  if (!handle || handle->fs_fd == INVALID_FD)
     return ConvertResult(ResultCode::Invalid);
 
   // Simulate the FS read logic to estimate ticks. Note: this must be done before reading.
-  ticks.Add(EstimateTicksForReadWrite(handle, fd, IPC_CMD_READ, size));
+  ticks.Add(EstimateTicksForReadWrite(*handle, IPC_CMD_READ, size));
 
-  const Result<u32> result = m_ios.GetFS()->ReadBytesFromFile(handle.fs_fd, data, size);
+  const Result<u32> result = m_ios.GetFS()->ReadBytesFromFile(handle->fs_fd, data, size);
   if (ipc_buffer_addr)
-    LogResult(result, "Read({}, 0x{:08x}, {})", handle.name.data(), *ipc_buffer_addr, size);
+    LogResult(result, "Read({}, 0x{:08x}, {})", handle->name.data(), *ipc_buffer_addr, size);
 
   if (!result)
     return ConvertResult(result.Error());
@@ -352,6 +370,29 @@ s32 FSCore::Read(u64 fd, u8* data, u32 size, std::optional<u32> ipc_buffer_addr,
   return *result;
 }
 
+s32 FSCore::ReadFromBuffer(u64 fd, std::span<const u8> file_data, u8* data, u32 size,
+                           Ticks ticks)
+{
+  Handle* handle = FindHandle(fd);
+  if (!handle || handle->fs_fd == INVALID_FD)
+    return Read(fd, data, size, {}, ticks);
+
+  const Result<FileStatus> status = m_ios.GetFS()->GetFileStatus(handle->fs_fd);
+  if (!status || status->size != file_data.size() || status->offset > status->size)
+    return Read(fd, data, size, {}, ticks);
+
+  ticks.Add(IPC_OVERHEAD_TICKS);
+  ticks.Add(EstimateTicksForReadWrite(*handle, IPC_CMD_READ, size));
+
+  const u32 count = std::min(size, status->size - status->offset);
+  std::copy_n(file_data.data() + status->offset, count, data);
+  const Result<u32> result =
+      m_ios.GetFS()->SeekFile(handle->fs_fd, status->offset + count, FS::SeekMode::Set);
+  if (!result)
+    return ConvertResult(result.Error());
+  return count;
+}
+
 std::optional<IPCReply> FSDevice::Write(const ReadWriteRequest& request)
 {
   return MakeIPCReply([&](Ticks t) {
@@ -366,16 +407,16 @@ s32 FSCore::Write(u64 fd, const u8* data, u32 size, std::optional<u32> ipc_buffe
 {
   ticks.Add(IPC_OVERHEAD_TICKS);
 
-  const Handle& handle = m_fd_map[fd];
-  if (handle.fs_fd == INVALID_FD)
+  Handle* handle = FindHandle(fd);
+  if (!handle || handle->fs_fd == INVALID_FD)
     return ConvertResult(ResultCode::Invalid);
 
   // Simulate the FS write logic to estimate ticks. Must be done before writing.
-  ticks.Add(EstimateTicksForReadWrite(handle, fd, IPC_CMD_WRITE, size));
+  ticks.Add(EstimateTicksForReadWrite(*handle, IPC_CMD_WRITE, size));
 
-  const Result<u32> result = m_ios.GetFS()->WriteBytesToFile(handle.fs_fd, data, size);
+  const Result<u32> result = m_ios.GetFS()->WriteBytesToFile(handle->fs_fd, data, size);
   if (ipc_buffer_addr)
-    LogResult(result, "Write({}, 0x{:08x}, {})", handle.name.data(), *ipc_buffer_addr, size);
+    LogResult(result, "Write({}, 0x{:08x}, {})", handle->name.data(), *ipc_buffer_addr, size);
 
   if (!result)
     return ConvertResult(result.Error());
@@ -394,12 +435,12 @@ s32 FSCore::Seek(u64 fd, u32 offset, FS::SeekMode mode, Ticks ticks)
 {
   ticks.Add(IPC_OVERHEAD_TICKS);
 
-  const Handle& handle = m_fd_map[fd];
-  if (handle.fs_fd == INVALID_FD)
+  Handle* handle = FindHandle(fd);
+  if (!handle || handle->fs_fd == INVALID_FD)
     return ConvertResult(ResultCode::Invalid);
 
-  const Result<u32> result = m_ios.GetFS()->SeekFile(handle.fs_fd, offset, mode);
-  LogResult(result, "Seek({}, 0x{:08x}, {})", handle.name.data(), offset, static_cast<int>(mode));
+  const Result<u32> result = m_ios.GetFS()->SeekFile(handle->fs_fd, offset, mode);
+  LogResult(result, "Seek({}, 0x{:08x}, {})", handle->name.data(), offset, static_cast<int>(mode));
   if (!result)
     return ConvertResult(result.Error());
   return *result;
@@ -446,34 +487,34 @@ static Result<T> GetParams(Memory::MemoryManager& memory, const IOCtlRequest& re
 
 std::optional<IPCReply> FSDevice::IOCtl(const IOCtlRequest& request)
 {
-  const auto it = m_core.m_fd_map.find(request.fd);
-  if (it == m_core.m_fd_map.end())
+  const Handle* handle = m_core.FindHandle(request.fd);
+  if (!handle)
     return IPCReply(ConvertResult(ResultCode::Invalid));
 
   switch (request.request)
   {
   case ISFS_IOCTL_FORMAT:
-    return Format(it->second, request);
+    return Format(*handle, request);
   case ISFS_IOCTL_GETSTATS:
-    return GetStats(it->second, request);
+    return GetStats(*handle, request);
   case ISFS_IOCTL_CREATEDIR:
-    return CreateDirectory(it->second, request);
+    return CreateDirectory(*handle, request);
   case ISFS_IOCTL_SETATTR:
-    return SetAttribute(it->second, request);
+    return SetAttribute(*handle, request);
   case ISFS_IOCTL_GETATTR:
-    return GetAttribute(it->second, request);
+    return GetAttribute(*handle, request);
   case ISFS_IOCTL_DELETE:
-    return DeleteFile(it->second, request);
+    return DeleteFile(*handle, request);
   case ISFS_IOCTL_RENAME:
-    return RenameFile(it->second, request);
+    return RenameFile(*handle, request);
   case ISFS_IOCTL_CREATEFILE:
-    return CreateFile(it->second, request);
+    return CreateFile(*handle, request);
   case ISFS_IOCTL_SETFILEVERCTRL:
-    return SetFileVersionControl(it->second, request);
+    return SetFileVersionControl(*handle, request);
   case ISFS_IOCTL_GETFILESTATS:
-    return GetFileStats(it->second, request);
+    return GetFileStats(*handle, request);
   case ISFS_IOCTL_SHUTDOWN:
-    return Shutdown(it->second, request);
+    return Shutdown(*handle, request);
   default:
     return GetFSReply(ConvertResult(ResultCode::Invalid));
   }
@@ -481,16 +522,16 @@ std::optional<IPCReply> FSDevice::IOCtl(const IOCtlRequest& request)
 
 std::optional<IPCReply> FSDevice::IOCtlV(const IOCtlVRequest& request)
 {
-  const auto it = m_core.m_fd_map.find(request.fd);
-  if (it == m_core.m_fd_map.end())
+  const Handle* handle = m_core.FindHandle(request.fd);
+  if (!handle)
     return IPCReply(ConvertResult(ResultCode::Invalid));
 
   switch (request.request)
   {
   case ISFS_IOCTLV_READDIR:
-    return ReadDirectory(it->second, request);
+    return ReadDirectory(*handle, request);
   case ISFS_IOCTLV_GETUSAGE:
-    return GetUsage(it->second, request);
+    return GetUsage(*handle, request);
   default:
     return GetFSReply(ConvertResult(ResultCode::Invalid));
   }
@@ -746,12 +787,12 @@ IPCReply FSDevice::GetFileStats(const Handle& handle, const IOCtlRequest& reques
 FS::Result<FS::FileStatus> FSCore::GetFileStatus(u64 fd, Ticks ticks)
 {
   ticks.Add(IPC_OVERHEAD_TICKS);
-  const auto& handle = m_fd_map[fd];
-  if (handle.fs_fd == INVALID_FD)
+  const Handle* handle = FindHandle(fd);
+  if (!handle || handle->fs_fd == INVALID_FD)
     return ResultCode::Invalid;
 
-  auto status = m_ios.GetFS()->GetFileStatus(handle.fs_fd);
-  LogResult(status, "GetFileStatus({})", handle.name.data());
+  auto status = m_ios.GetFS()->GetFileStatus(handle->fs_fd);
+  LogResult(status, "GetFileStatus({})", handle->name.data());
   return status;
 }
 
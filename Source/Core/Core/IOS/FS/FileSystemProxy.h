@@ -4,8 +4,8 @@
 #pragma once
 
 #include <array>
-#include <map>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 
@@ -68,6 +68,9 @@ public:
   s32 Read(u64 fd, u8* data, u32 size, std::optional<u32> ipc_buffer_addr = {}, Ticks ticks = {});
   s32 Write(u64 fd, const u8* data, u32 size, std::optional<u32> ipc_buffer_addr = {},
             Ticks ticks = {});
+  // Same as Read, but copies from file_data (which must hold the contents of the file)
+  // instead of reading from the file system. Falls back to Read if the file size differs.
+  s32 ReadFromBuffer(u64 fd, std::span<const u8> file_data, u8* data, u32 size, Ticks ticks = {});
   s32 Seek(u64 fd, u32 offset, FS::SeekMode mode, Ticks ticks = {});
 
   FS::Result<FS::FileStatus> GetFileStatus(u64 fd, Ticks ticks = {});
@@ -88,6 +91,8 @@ public:
 private:
   struct Handle
   {
+    bool opened = false;
+    u64 fd = 0;
     u16 gid = 0;
     u32 uid = 0;
     FS::Fd fs_fd = INVALID_FD;
@@ -96,7 +101,10 @@ private:
     bool superblock_flush_needed = false;
   };
 
-  u64 EstimateTicksForReadWrite(const Handle& handle, u64 fd, IPCCommandType command, u32 size);
+  Handle* FindHandle(u64 fd);
+  Handle* AllocateHandle(u64 fd);
+
+  u64 EstimateTicksForReadWrite(Handle& handle, IPCCommandType command, u32 size);
   u64 SimulatePopulateFileCache(u64 fd, u32 offset, u32 file_size);
   u64 SimulateFlushFileCache();
   bool HasCacheForFile(u64 fd, u32 offset) const;
@@ -108,7 +116,8 @@ private:
   std::optional<u64> m_cache_fd;
   // The first 0x18 IDs are reserved for the PPC.
   u64 m_next_fd = 0x18;
-  std::map<u64, Handle> m_fd_map;
+  // IOS only supports 16 open files at a time, so a linear search is fast enough.
+  std::array<Handle, 16> m_handles{};
 
   friend class FSDevice;
 };
@@ -16,6 +16,7 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 #include "Common/NandPaths.h"
 #include "Common/StringUtil.h"
@@ -80,6 +81,42 @@ struct SerializedFstEntry
 static_assert(std::is_standard_layout<SerializedFstEntry>());
 static_assert(sizeof(SerializedFstEntry) == 0x20);
 
+constexpr u32 FST_JOURNAL_MAGIC = 0x4653544A;  // 'FSTJ'
+// Bounds the size of the journal (and the time it takes to replay it).
+constexpr u32 FST_JOURNAL_MAX_RECORDS = 1024;
+
+struct SerializedFstJournalHeader
+{
+  Common::BigEndianValue<u32> magic{};
+  /// Checksum of the FST file this journal applies to.
+  Common::BigEndianValue<u32> fst_checksum{};
+};
+static_assert(sizeof(SerializedFstJournalHeader) == 0x8);
+
+struct SerializedFstJournalRecord
+{
+  static std::string_view GetPath(const std::array<char, MaxPathLength>& path)
+  {
+    return {path.data(), strnlen(path.data(), path.size())};
+  }
+  static void SetPath(std::array<char, MaxPathLength>* path, std::string_view new_path)
+  {
+    std::memcpy(path->data(), new_path.data(), std::min(path->size(), new_path.length()));
+  }
+
+  /// Metadata of the entry (for Create and SetMetadata)
+  SerializedFstEntry entry{};
+  /// Path of the entry
+  std::array<char, MaxPathLength> path{};
+  /// New path of the entry (for Rename)
+  std::array<char, MaxPathLength> new_path{};
+  /// Operation (HostFileSystem::FstJournalOp)
+  u8 op = 0;
+  std::array<u8, 3> padding{};
+};
+static_assert(std::is_standard_layout<SerializedFstJournalRecord>());
+static_assert(sizeof(SerializedFstJournalRecord) == 0xa4);
+
 template <typename T>
 auto GetMetadataFields(T& obj)
 {
@@ -153,17 +190,27 @@ HostFileSystem::HostFileSystem(const std::string& root_path,
   File::CreateFullPath(m_root_path + '/');
   ResetFst();
   LoadFst();
+  ReplayFstJournal();
 }
 
-HostFileSystem::~HostFileSystem() = default;
+HostFileSystem::~HostFileSystem()
+{
+  FlushFst();
+}
 
 std::string HostFileSystem::GetFstFilePath() const
 {
   return fmt::format("{}/fst.bin", m_root_path);
 }
 
+std::string HostFileSystem::GetFstJournalFilePath() const
+{
+  return fmt::format("{}/fst.journal", m_root_path);
+}
+
 void HostFileSystem::ResetFst()
 {
+  m_fst_index.clear();
   m_root_entry = {};
   m_root_entry.name = "/";
   // Mode 0x16 (Directory | Owner_None | Group_Read | Other_Read) in the FS sysmodule
@@ -172,19 +219,24 @@ void HostFileSystem::ResetFst()
 
 void HostFileSystem::LoadFst()
 {
-  File::IOFile file{GetFstFilePath(), "rb"};
   // Existing filesystems will not have a FST. This is not a problem,
   // as the rest of HostFileSystem will use sane defaults.
-  if (!file)
+  std::string contents;
+  if (!File::ReadFileToString(GetFstFilePath(), contents))
+    contents.clear();
+  m_fst_checksum = Common::ComputeCRC32(contents);
+  if (contents.empty())
     return;
 
-  const auto parse_entry = [&file](const auto& parse, size_t depth) -> std::optional<FstEntry> {
-    if (depth > MaxPathDepth)
+  const size_t num_entries = contents.size() / sizeof(SerializedFstEntry);
+  size_t next_entry = 0;
+  const auto parse_entry = [&](const auto& parse, size_t depth) -> std::optional<FstEntry> {
+    if (depth > MaxPathDepth || next_entry >= num_entries)
       return std::nullopt;
 
     SerializedFstEntry entry;
-    if (!file.ReadArray(&entry, 1))
-      return std::nullopt;
+    std::memcpy(&entry, contents.data() + next_entry * sizeof(SerializedFstEntry), sizeof(entry));
+    ++next_entry;
 
     FstEntry result;
     result.name = entry.GetName();
@@ -205,9 +257,121 @@ void HostFileSystem::LoadFst()
     ERROR_LOG_FMT(IOS_FS, "Failed to parse FST: at least one of the entries was invalid");
     return;
   }
+  m_fst_index.clear();
   m_root_entry = *root_entry;
 }
 
+void HostFileSystem::ReplayFstJournal()
+{
+  File::IOFile file{GetFstJournalFilePath(), "rb"};
+  if (!file)
+    return;
+
+  SerializedFstJournalHeader header;
+  if (!file.ReadArray(&header, 1) || header.magic != FST_JOURNAL_MAGIC)
+  {
+    ERROR_LOG_FMT(IOS_FS, "Ignoring invalid FST journal");
+    return;
+  }
+
+  // The journal is only deleted after the FST it was folded into has been written, so it may
+  // refer to an older FST if Dolphin was closed in between. Its changes are already in the FST.
+  if (header.fst_checksum != m_fst_checksum)
+  {
+    INFO_LOG_FMT(IOS_FS, "Ignoring FST journal for a different FST");
+    return;
+  }
+
+  // Unlike GetFstEntryForPath, this does not check whether the files exist on the host:
+  // the FST only has to end up in the same state as it was in when the journal was written.
+  const auto get_entry = [this](std::string_view path, bool create) -> FstEntry* {
+    FstEntry* entry = &m_root_entry;
+    if (path == "/")
+      return entry;
+    for (const std::string& component : SplitString(std::string(path.substr(1)), '/'))
+    {
+      const auto next =
+          std::find_if(entry->children.begin(), entry->children.end(), GetNamePredicate(component));
+      if (next != entry->children.end())
+      {
+        entry = &*next;
+        continue;
+      }
+      if (!create)
+        return nullptr;
+      entry = &entry->children.emplace_back();
+      entry->name = component;
+      entry->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
+    }
+    return entry;
+  };
+
+  const auto remove_child = [&get_entry](const SplitPathResult& split_path) {
+    FstEntry* parent = get_entry(split_path.parent, false);
+    if (!parent)
+      return std::optional<FstEntry>{};
+    const auto it = std::find_if(parent->children.begin(), parent->children.end(),
+                                 GetNamePredicate(split_path.file_name));
+    if (it == parent->children.end())
+      return std::optional<FstEntry>{};
+    std::optional<FstEntry> child = std::move(*it);
+    parent->children.erase(it);
+    return child;
+  };
+
+  size_t num_records = 0;
+  SerializedFstJournalRecord record;
+  // A partially written record at the end of the journal is simply ignored.
+  while (file.ReadArray(&record, 1))
+  {
+    const std::string path{SerializedFstJournalRecord::GetPath(record.path)};
+    if (!IsValidPath(path))
+      break;
+
+    switch (static_cast<FstJournalOp>(record.op))
+    {
+    case FstJournalOp::Create:
+    {
+      FstEntry* entry = get_entry(path, true);
+      *entry = {};
+      entry->name = record.entry.GetName();
+      GetMetadataFields(entry->data) = GetMetadataFields(record.entry);
+      break;
+    }
+    case FstJournalOp::SetMetadata:
+      GetMetadataFields(get_entry(path, true)->data) = GetMetadataFields(record.entry);
+      break;
+    case FstJournalOp::Delete:
+      remove_child(SplitPathAndBasename(path));
+      break;
+    case FstJournalOp::Rename:
+    {
+      const std::string new_path{SerializedFstJournalRecord::GetPath(record.new_path)};
+      if (!IsValidNonRootPath(new_path))
+        break;
+      std::optional<FstEntry> old_entry = remove_child(SplitPathAndBasename(path));
+      FstEntry* new_entry = get_entry(new_path, true);
+      new_entry->name = SplitPathAndBasename(new_path).file_name;
+      if (old_entry)
+      {
+        new_entry->data = old_entry->data;
+        new_entry->children = std::move(old_entry->children);
+      }
+      break;
+    }
+    default:
+      ERROR_LOG_FMT(IOS_FS, "Unknown FST journal operation {}", record.op);
+      break;
+    }
+    ++num_records;
+  }
+
+  file.Close();
+  m_fst_index.clear();
+  INFO_LOG_FMT(IOS_FS, "Replayed {} FST journal records", num_records);
+  SaveFst();
+}
+
 void HostFileSystem::SaveFst()
 {
   std::vector<SerializedFstEntry> to_write;
@@ -233,7 +397,76 @@ void HostFileSystem::SaveFst()
     }
   }
   if (!File::Rename(temp_path, dest_path))
+  {
     PanicAlertFmt("IOS_FS: Failed to rename temporary FST file");
+    return;
+  }
+
+  m_fst_checksum = Common::ComputeCRC32(reinterpret_cast<const u8*>(to_write.data()),
+                                        to_write.size() * sizeof(SerializedFstEntry));
+  m_fst_dirty = false;
+
+  // Everything in the journal is now part of the FST.
+  m_fst_journal.Close();
+  m_fst_journal_records = 0;
+  File::Delete(GetFstJournalFilePath(), File::IfAbsentBehavior::NoConsoleWarning);
+}
+
+void HostFileSystem::FlushFst()
+{
+  if (m_fst_dirty)
+    SaveFst();
+}
+
+void HostFileSystem::JournalFstChange(FstJournalOp op, const std::string& path,
+                                      const FstEntry* entry, const std::string& new_path)
+{
+  // The FST for redirected paths only lives in memory.
+  const bool is_redirect = BuildFilename(path).is_redirect;
+  if (op == FstJournalOp::Rename && is_redirect != BuildFilename(new_path).is_redirect)
+  {
+    // The entry moved between the NAND FST and the redirect FST, which cannot be expressed
+    // as a journal record.
+    SaveFst();
+    return;
+  }
+  if (is_redirect)
+    return;
+
+  if (!m_fst_journal.IsOpen())
+  {
+    SerializedFstJournalHeader header;
+    header.magic = FST_JOURNAL_MAGIC;
+    header.fst_checksum = m_fst_checksum;
+    if (!m_fst_journal.Open(GetFstJournalFilePath(), "wb") || !m_fst_journal.WriteArray(&header, 1))
+    {
+      ERROR_LOG_FMT(IOS_FS, "Failed to create FST journal; writing the whole FST instead");
+      m_fst_journal.Close();
+      SaveFst();
+      return;
+    }
+  }
+
+  SerializedFstJournalRecord record;
+  record.op = static_cast<u8>(op);
+  SerializedFstJournalRecord::SetPath(&record.path, path);
+  SerializedFstJournalRecord::SetPath(&record.new_path, new_path);
+  if (entry)
+  {
+    record.entry.SetName(entry->name);
+    GetMetadataFields(record.entry) = GetMetadataFields(entry->data);
+  }
+
+  m_fst_dirty = true;
+  if (!m_fst_journal.WriteArray(&record, 1) || !m_fst_journal.Flush())
+  {
+    ERROR_LOG_FMT(IOS_FS, "Failed to write to FST journal; writing the whole FST instead");
+    SaveFst();
+    return;
+  }
+
+  if (++m_fst_journal_records >= FST_JOURNAL_MAX_RECORDS)
+    SaveFst();
 }
 
 HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string& path)
@@ -249,34 +482,47 @@ HostFileSystem::FstEntry* HostFileSystem::GetFstEntryForPath(const std::string&
   if (!host_file_info.Exists())
     return nullptr;
 
-  FstEntry* entry = host_file.is_redirect ? &m_redirect_fst : &m_root_entry;
-  std::string complete_path = "";
-  for (const std::string& component : SplitString(std::string(path.substr(1)), '/'))
+  FstEntry* entry = nullptr;
+  if (const auto it = m_fst_index.find(path); it != m_fst_index.end())
   {
-    complete_path += '/' + component;
-    const auto next =
-        std::find_if(entry->children.begin(), entry->children.end(), GetNamePredicate(component));
-    if (next != entry->children.end())
-    {
-      entry = &*next;
-    }
-    else
+    entry = it->second;
+  }
+  else
+  {
+    entry = host_file.is_redirect ? &m_redirect_fst : &m_root_entry;
+    std::string complete_path = "";
+    for (const std::string& component : SplitString(std::string(path.substr(1)), '/'))
     {
-      // Fall back to dummy data to avoid breaking existing filesystems.
-      // This code path is also reached when creating a new file or directory;
-      // proper metadata is filled in later.
-      INFO_LOG_FMT(IOS_FS, "Creating a default entry for {} ({})", complete_path,
-                   host_file.is_redirect ? "redirect" : "NAND");
-      entry = &entry->children.emplace_back();
-      entry->name = component;
-      entry->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
+      complete_path += '/' + component;
+      const auto next = std::find_if(entry->children.begin(), entry->children.end(),
+                                     GetNamePredicate(component));
+      if (next != entry->children.end())
+      {
+        entry = &*next;
+      }
+      else
+      {
+        // Fall back to dummy data to avoid breaking existing filesystems.
+        // This code path is also reached when creating a new file or directory;
+        // proper metadata is filled in later.
+        INFO_LOG_FMT(IOS_FS, "Creating a default entry for {} ({})", complete_path,
+                     host_file.is_redirect ? "redirect" : "NAND");
+        // This may move the siblings of the new entry.
+        m_fst_index.clear();
+        entry = &entry->children.emplace_back();
+        entry->name = component;
+        entry->data.modes = {Mode::ReadWrite, Mode::ReadWrite, Mode::ReadWrite};
+      }
     }
+    m_fst_index.emplace(path, entry);
   }
 
   entry->data.is_file = host_file_info.IsFile();
   if (entry->data.is_file && !entry->children.empty())
   {
     WARN_LOG_FMT(IOS_FS, "{} is a file but also has children; clearing children", path);
+    m_fst_index.clear();
+    m_fst_index.emplace(path, entry);
     entry->children.clear();
   }
 
@@ -373,6 +619,8 @@ void HostFileSystem::DoStateWriteOrMeasure(PointerWrap& p, std::string start_dir
 
 void HostFileSystem::DoState(PointerWrap& p)
 {
+  FlushFst();
+
   // Temporarily close the file, to prevent any issues with the savestating of files/folders.
   for (Handle& handle : m_handles)
     handle.host_file.reset();
@@ -491,6 +739,7 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   }
 
   FstEntry* child = GetFstEntryForPath(path);
+  m_fst_index.clear();
   *child = {};
   child->name = split_path.file_name;
   child->data.is_file = is_file;
@@ -498,7 +747,7 @@ ResultCode HostFileSystem::CreateFileOrDirectory(Uid uid, Gid gid, const std::st
   child->data.uid = uid;
   child->data.gid = gid;
   child->data.attribute = attr;
-  SaveFst();
+  JournalFstChange(FstJournalOp::Create, path, child);
   return ResultCode::Success;
 }
 
@@ -556,8 +805,11 @@ ResultCode HostFileSystem::Delete(Uid uid, Gid gid, const std::string& path)
   const auto it = std::find_if(parent->children.begin(), parent->children.end(),
                                GetNamePredicate(split_path.file_name));
   if (it != parent->children.end())
+  {
+    m_fst_index.clear();
     parent->children.erase(it);
-  SaveFst();
+  }
+  JournalFstChange(FstJournalOp::Delete, path, nullptr);
 
   return ResultCode::Success;
 }
@@ -639,21 +891,28 @@ ResultCode HostFileSystem::Rename(Uid uid, Gid gid, const std::string& old_path,
     }
   }
 
-  FstEntry* new_entry = GetFstEntryForPath(new_path);
-  new_entry->name = split_new_path.file_name;
-
   // Finally, remove the child from the old parent and move it to the new parent.
+  // The parent is looked up again because creating entries may have moved it.
+  old_parent = GetFstEntryForPath(split_old_path.parent);
+  std::optional<FstEntry> old_entry;
   const auto it = std::find_if(old_parent->children.begin(), old_parent->children.end(),
                                GetNamePredicate(split_old_path.file_name));
   if (it != old_parent->children.end())
   {
-    new_entry->data = it->data;
-    new_entry->children = it->children;
-
+    old_entry = std::move(*it);
     old_parent->children.erase(it);
   }
+  m_fst_index.clear();
 
-  SaveFst();
+  FstEntry* new_entry = GetFstEntryForPath(new_path);
+  new_entry->name = split_new_path.file_name;
+  if (old_entry)
+  {
+    new_entry->data = old_entry->data;
+    new_entry->children = std::move(old_entry->children);
+  }
+
+  JournalFstChange(FstJournalOp::Rename, old_path, nullptr, new_path);
 
   return ResultCode::Success;
 }
@@ -767,7 +1026,7 @@ ResultCode HostFileSystem::SetMetadata(Uid caller_uid, const std::string& path,
     entry->data.uid = uid;
     entry->data.attribute = attr;
     entry->data.modes = modes;
-    SaveFst();
+    JournalFstChange(FstJournalOp::SetMetadata, path, entry);
   }
 
   return ResultCode::Success;
@@ -848,5 +1107,6 @@ HostFileSystem::GetExtendedDirectoryStats(const std::string& wii_path)
 void HostFileSystem::SetNandRedirects(std::vector<NandRedirect> nand_redirects)
 {
   m_nand_redirects = std::move(nand_redirects);
+  m_fst_index.clear();
 }
 }  // namespace IOS::HLE::FS
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -101,10 +102,27 @@ private:
   bool IsFileOpened(const std::string& path) const;
   bool IsDirectoryInUse(const std::string& path) const;
 
+  enum class FstJournalOp : u8
+  {
+    Create,
+    SetMetadata,
+    Delete,
+    Rename,
+  };
+
   std::string GetFstFilePath() const;
+  std::string GetFstJournalFilePath() const;
   void ResetFst();
   void LoadFst();
+  void ReplayFstJournal();
+  /// Writes the whole FST to disk and discards the journal.
   void SaveFst();
+  /// Writes the FST to disk if there are changes that have only been journaled so far.
+  void FlushFst();
+  /// Appends a change to the FST journal instead of rewriting the whole FST.
+  /// Changes to redirected paths are not persisted and are ignored.
+  void JournalFstChange(FstJournalOp op, const std::string& path, const FstEntry* entry,
+                        const std::string& new_path = {});
   /// Get the FST entry for a file (or directory).
   /// Automatically creates fallback entries for parents if they do not exist.
   /// Returns nullptr if the path is invalid or the file does not exist.
@@ -119,6 +137,22 @@ private:
   /// and we do not want FS to break if the user adds or removes files in their
   /// filesystem root manually.
   FstEntry m_root_entry{};
+  /// Cache of GetFstEntryForPath results, keyed by Wii path.
+  ///
+  /// The entries point into the children vectors of the FST, so this must be cleared
+  /// whenever an entry is added to or removed from the tree.
+  std::unordered_map<std::string, FstEntry*> m_fst_index;
+  /// Changes that have been made since the FST was last written to disk.
+  ///
+  /// Rewriting the FST after every change is expensive for titles that create and delete
+  /// many files, so changes are appended here and folded into the FST at flush points.
+  /// The journal is tied to the FST it applies to by a checksum, which makes it safe to
+  /// replay after a crash at any point.
+  File::IOFile m_fst_journal;
+  u32 m_fst_journal_records = 0;
+  /// Checksum of the FST file as currently stored on disk.
+  u32 m_fst_checksum = 0;
+  bool m_fst_dirty = false;
   std::string m_root_path;
   std::map<std::string, std::weak_ptr<File::IOFile>> m_open_files;
   std::array<Handle, 16> m_handles{};
@@ -757,6 +757,14 @@ std::optional<IPCReply> EmulationKernel::HandleIPCCommand(const Request& request
                  device->GetDeviceName(), wall_time_after - wall_time_before);
   }
 
+  // Compare how long the request took on the host with how long it takes on the console.
+  if (ret)
+  {
+    DEBUG_LOG_FMT(IOS, "Request {} to device {}: {} us on the host, reply after {} ticks",
+                  Common::ToUnderlying(request.command), device->GetDeviceName(),
+                  wall_time_after - wall_time_before, ret->reply_delay_ticks);
+  }
+
   return ret;
 }
 
@@ -3,16 +3,39 @@
 
 #include "Core/MemoryWatcher.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <fcntl.h>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include "Common/FileUtil.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/PowerPC/MMU.h"
 
+struct MemoryWatcher::RingHeader
+{
+  u32 magic;
+  u32 version;
+  u32 address_count;
+  u32 capacity;
+  u64 write_count;
+};
+
+struct MemoryWatcher::RingRecord
+{
+  u32 line;
+  u32 value;
+};
+
+constexpr u32 RING_MAGIC = 0x52574d44;  // "DMWR"
+constexpr u32 RING_VERSION = 1;
+constexpr u32 MIN_RING_CAPACITY = 4096;
+
 MemoryWatcher::MemoryWatcher()
 {
   m_running = false;
@@ -20,11 +43,15 @@ MemoryWatcher::MemoryWatcher()
     return;
   if (!OpenSocket(File::GetUserPath(F_MEMORYWATCHERSOCKET_IDX)))
     return;
+  OpenRing(File::GetUserPath(F_MEMORYWATCHERRING_IDX));
   m_running = true;
 }
 
 MemoryWatcher::~MemoryWatcher()
 {
+  if (m_ring)
+    munmap(m_ring, m_ring_size);
+
   if (!m_running)
     return;
 
@@ -39,23 +66,37 @@ bool MemoryWatcher::LoadAddresses(const std::string& path)
   if (!locations)
     return false;
 
+  // The root of every pointer chain.
+  m_nodes.push_back({0, 0});
+
+  std::map<std::pair<u32, u32>, u32> node_lookup;
   std::string line;
-  while (std::getline(locations, line))
-    ParseLine(line);
+  for (u32 line_number = 0; std::getline(locations, line); ++line_number)
+    ParseLine(line, line_number, &node_lookup);
 
-  return !m_values.empty();
+  return !m_watches.empty();
 }
 
-void MemoryWatcher::ParseLine(const std::string& line)
+void MemoryWatcher::ParseLine(const std::string& line, u32 line_number,
+                              std::map<std::pair<u32, u32>, u32>* node_lookup)
 {
-  m_values[line] = 0;
-  m_addresses[line] = std::vector<u32>();
+  if (std::ranges::any_of(m_watches, [&](const Watch& watch) { return watch.line == line; }))
+    return;
 
   std::istringstream offsets(line);
   offsets >> std::hex;
+  u32 node = 0;
   u32 offset;
   while (offsets >> offset)
-    m_addresses[line].push_back(offset);
+  {
+    const auto [iter, inserted] =
+        node_lookup->try_emplace({node, offset}, static_cast<u32>(m_nodes.size()));
+    if (inserted)
+      m_nodes.push_back({node, offset});
+    node = iter->second;
+  }
+
+  m_watches.push_back({line, line_number, node});
 }
 
 bool MemoryWatcher::OpenSocket(const std::string& path)
@@ -67,37 +108,87 @@ bool MemoryWatcher::OpenSocket(const std::string& path)
   return m_fd >= 0;
 }
 
-u32 MemoryWatcher::ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line)
+void MemoryWatcher::OpenRing(const std::string& path)
+{
+  // Clients depend on this layout.
+  static_assert(sizeof(RingHeader) == 24);
+  static_assert(sizeof(RingRecord) == 8);
+
+  const u32 capacity = std::max<u32>(MIN_RING_CAPACITY, static_cast<u32>(m_watches.size()) * 4);
+  const size_t size = sizeof(RingHeader) + capacity * sizeof(RingRecord);
+
+  const int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (fd < 0)
+    return;
+
+  void* memory = MAP_FAILED;
+  if (ftruncate(fd, size) == 0)
+    memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (memory == MAP_FAILED)
+    return;
+
+  m_ring = static_cast<RingHeader*>(memory);
+  m_ring_records = reinterpret_cast<RingRecord*>(static_cast<u8*>(memory) + sizeof(RingHeader));
+  m_ring_size = size;
+
+  m_ring->magic = RING_MAGIC;
+  m_ring->version = RING_VERSION;
+  m_ring->address_count = static_cast<u32>(m_watches.size());
+  m_ring->capacity = capacity;
+  std::atomic_ref(m_ring->write_count).store(0, std::memory_order_release);
+}
+
+void MemoryWatcher::ResolveChains(const Core::CPUThreadGuard& guard)
 {
-  u32 value = 0;
-  for (u32 offset : m_addresses[line])
+  for (size_t i = 1; i < m_nodes.size(); ++i)
   {
-    value = PowerPC::MMU::HostRead_U32(guard, value + offset);
-    if (!PowerPC::MMU::HostIsRAMAddress(guard, value))
-      break;
+    ChainNode& node = m_nodes[i];
+    const ChainNode& parent = m_nodes[node.parent];
+    if (parent.stopped)
+    {
+      node.value = parent.value;
+      node.stopped = true;
+      continue;
+    }
+
+    node.value = PowerPC::MMU::HostRead_U32(guard, parent.value + node.offset);
+    node.stopped = !PowerPC::MMU::HostIsRAMAddress(guard, node.value);
   }
-  return value;
+}
+
+void MemoryWatcher::WriteRecord(u32 line_number, u32 value)
+{
+  RingRecord& record = m_ring_records[m_ring_write_count % m_ring->capacity];
+  record.line = line_number;
+  record.value = value;
+  ++m_ring_write_count;
 }
 
 std::string MemoryWatcher::ComposeMessages(const Core::CPUThreadGuard& guard)
 {
+  ResolveChains(guard);
+
   std::ostringstream message_stream;
   message_stream << std::hex;
 
-  for (auto& entry : m_values)
+  for (Watch& watch : m_watches)
   {
-    std::string address = entry.first;
-    u32& current_value = entry.second;
-
-    u32 new_value = ChasePointer(guard, address);
-    if (new_value != current_value)
+    const u32 new_value = m_nodes[watch.node].value;
+    if (new_value != watch.value)
     {
       // Update the value
-      current_value = new_value;
-      message_stream << address << '\n' << new_value << '\n';
+      watch.value = new_value;
+      message_stream << watch.line << '\n' << new_value << '\n';
+
+      if (m_ring)
+        WriteRecord(watch.line_number, new_value);
     }
   }
 
+  if (m_ring)
+    std::atomic_ref(m_ring->write_count).store(m_ring_write_count, std::memory_order_release);
+
   return message_stream.str();
 }
 
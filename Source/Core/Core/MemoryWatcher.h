@@ -9,6 +9,7 @@
 #include <string>
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <utility>
 #include <vector>
 
 namespace Core
@@ -24,6 +25,19 @@ class CPUThreadGuard;
 // "ABCD EF" will watch the address at (*0xABCD) + 0xEF.
 // The output to the socket is two lines. The first is the address from the
 // input file, and the second is the new value in hex.
+//
+// The same changes are also written to a ring buffer in a file next to the
+// socket (MemoryWatcher.ring), which clients watching many addresses can mmap
+// instead of parsing text. All fields are in host byte order:
+//
+//   u32 magic ("DMWR")      u32 version (1)
+//   u32 address count       u32 record capacity
+//   u64 write count         (number of records written so far)
+//   records of {u32 line, u32 value}, record n being at index n % capacity
+//
+// line is the zero-based line of the address in the input file. The write
+// count is updated after the records it covers have been written. A reader
+// that is more than the capacity behind the write count has missed changes.
 class MemoryWatcher final
 {
 public:
@@ -32,20 +46,51 @@ public:
   void Step(const Core::CPUThreadGuard& guard);
 
 private:
+  struct RingHeader;
+  struct RingRecord;
+
+  // One step of a pointer chain. Chains that start with the same offsets share
+  // their nodes, so every distinct prefix is only read once per step. Parents
+  // always come before their children.
+  struct ChainNode
+  {
+    u32 parent;
+    u32 offset;
+    u32 value = 0;
+    // Set if the chain couldn't be followed up to this node because an
+    // earlier value wasn't a RAM address. value is then the value that
+    // stopped the chain.
+    bool stopped = false;
+  };
+
+  struct Watch
+  {
+    std::string line;
+    u32 line_number;
+    u32 node;
+    u32 value = 0;
+  };
+
   bool LoadAddresses(const std::string& path);
   bool OpenSocket(const std::string& path);
+  void OpenRing(const std::string& path);
 
-  void ParseLine(const std::string& line);
-  u32 ChasePointer(const Core::CPUThreadGuard& guard, const std::string& line);
+  void ParseLine(const std::string& line, u32 line_number,
+                 std::map<std::pair<u32, u32>, u32>* node_lookup);
+  void ResolveChains(const Core::CPUThreadGuard& guard);
   std::string ComposeMessages(const Core::CPUThreadGuard& guard);
+  void WriteRecord(u32 line_number, u32 value);
 
   bool m_running = false;
 
   int m_fd;
   sockaddr_un m_addr{};
 
-  // Address as stored in the file -> list of offsets to follow
-  std::map<std::string, std::vector<u32>> m_addresses;
-  // Address as stored in the file -> current value
-  std::map<std::string, u32> m_values;
+  std::vector<ChainNode> m_nodes;
+  std::vector<Watch> m_watches;
+
+  RingHeader* m_ring = nullptr;
+  RingRecord* m_ring_records = nullptr;
+  size_t m_ring_size = 0;
+  u64 m_ring_write_count = 0;
 };
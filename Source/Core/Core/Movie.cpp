@@ -89,6 +89,28 @@ static bool IsMovieHeader(const std::array<u8, 4>& magic)
   return magic[0] == 'D' && magic[1] == 'T' && magic[2] == 'M' && magic[3] == 0x1A;
 }
 
+// While a movie plays back, a savestate is taken about this many frames apart (one minute at
+// 60 Hz), so that seeking never has to replay much more than that.
+static constexpr u64 KEYFRAME_INTERVAL = 60 * 60;
+
+// The keyframes are stored in a directory next to the movie instead of in the DTM itself, so the
+// DTM format stays the same for other programs. The index is followed by keyframe_count u64 frame
+// numbers in ascending order; the savestate for each is named after its frame number.
+static constexpr std::array<u8, 4> KEYFRAME_INDEX_MAGIC = {'D', 'T', 'K', 0x1A};
+static constexpr u32 KEYFRAME_INDEX_VERSION = 1;
+
+#pragma pack(push, 1)
+struct KeyframeIndexHeader
+{
+  std::array<u8, 4> filetype;  // Unique Identifier (always "DTK"0x1A)
+  u32 version;
+  u64 input_size;  // Size of the input data of the movie the keyframes were taken from
+  u32 input_hash;  // Adler-32 of that input data
+  u32 keyframe_count;
+};
+static_assert(sizeof(KeyframeIndexHeader) == 24, "KeyframeIndexHeader should be 24 bytes");
+#pragma pack(pop)
+
 static std::array<u8, 20> ConvertGitRevisionToBytes(const std::string& revision)
 {
   std::array<u8, 20> revision_bytes{};
@@ -196,6 +218,22 @@ void MovieManager::FrameUpdate()
   }
 
   m_polled = false;
+
+  if (m_seek_target_frame && m_current_frame >= *m_seek_target_frame)
+  {
+    StopSeeking();
+    m_system.GetCPU().Break();
+    Core::DisplayMessage(fmt::format("Reached frame {}", m_current_frame), 2000);
+  }
+
+  // The savestate can't be taken in the middle of a VI event, so leave it to the host thread.
+  if (IsPlayingInput() && m_read_only && !m_movie_path.empty() && !m_keyframe_pending &&
+      m_current_frame >= KEYFRAME_INTERVAL && !HasKeyframeNear(m_current_frame) &&
+      Config::Get(Config::MAIN_MOVIE_SAVE_KEYFRAMES))
+  {
+    m_keyframe_pending = true;
+    Core::QueueHostJob([this](Core::System&) { SaveKeyframe(); });
+  }
 }
 
 // called when game is booting up, even if no movie is active,
@@ -273,6 +311,10 @@ void MovieManager::SetReadOnly(bool bEnabled)
   if (m_read_only != bEnabled)
     Core::DisplayMessage(bEnabled ? "Read-only mode." : "Read+Write mode.", 1000);
 
+  // Keyframes are only valid for the exact input of the movie file, which can now diverge.
+  if (m_read_only && !bEnabled)
+    Core::RunOnCPUThread(m_system, [this] { ClearKeyframeIndex(); }, true);
+
   m_read_only = bEnabled;
 }
 
@@ -560,6 +602,7 @@ bool MovieManager::BeginRecordingInput(const ControllerTypeArray& controllers,
     m_play_mode = PlayMode::Recording;
     m_author = Config::Get(Config::MAIN_MOVIE_MOVIE_AUTHOR);
     m_temp_input.clear();
+    ClearKeyframeIndex();
 
     m_current_byte = 0;
 
@@ -964,6 +1007,10 @@ bool MovieManager::PlayInput(const std::string& movie_path,
   m_current_byte = 0;
   recording_file.Close();
 
+  m_movie_path = movie_path;
+  m_input_hash = Common::HashAdler32(m_temp_input.data(), m_temp_input.size());
+  LoadKeyframeIndex();
+
   // Load savestate (and skip to frame data)
   if (m_temp_header.bFromSaveState && savestate_path)
   {
@@ -1157,6 +1204,9 @@ void MovieManager::LoadInput(const std::string& movie_path)
     }
     else
     {
+      // The input is about to diverge from the movie file the keyframes were taken from.
+      ClearKeyframeIndex();
+
       if (m_play_mode != PlayMode::Recording)
       {
         m_play_mode = PlayMode::Recording;
@@ -1333,6 +1383,7 @@ void MovieManager::EndPlayInput(bool cont)
     ASSERT(IsMovieActive());
 
     m_play_mode = PlayMode::Recording;
+    ClearKeyframeIndex();
     Core::DisplayMessage("Reached movie end. Resuming recording.", 2000);
   }
   else if (m_play_mode != PlayMode::None)
@@ -1345,6 +1396,7 @@ void MovieManager::EndPlayInput(bool cont)
     m_rerecords = 0;
     m_current_byte = 0;
     m_play_mode = PlayMode::None;
+    ClearKeyframeIndex();
     Core::DisplayMessage("Movie End.", 2000);
     m_recording_from_save_state = false;
     Config::RemoveLayer(Config::LayerType::Movie);
@@ -1425,6 +1477,191 @@ void MovieManager::SaveRecording(const std::string& filename)
     Core::DisplayMessage(fmt::format("Failed to save {}", filename), 2000);
 }
 
+std::string MovieManager::GetKeyframeDirectory() const
+{
+  return m_movie_path + ".keyframes/";
+}
+
+std::string MovieManager::GetKeyframeIndexPath() const
+{
+  return GetKeyframeDirectory() + "index";
+}
+
+std::string MovieManager::GetKeyframePath(u64 frame) const
+{
+  return fmt::format("{}{}.sav", GetKeyframeDirectory(), frame);
+}
+
+// NOTE: Host Thread
+void MovieManager::LoadKeyframeIndex()
+{
+  m_keyframes.clear();
+  m_keyframe_pending = false;
+  StopSeeking();
+
+  const std::string directory = GetKeyframeDirectory();
+  if (!File::IsDirectory(directory))
+    return;
+
+  File::IOFile index_file(GetKeyframeIndexPath(), "rb");
+  KeyframeIndexHeader header;
+  // Keyframes taken from a different version of the movie would desync, so start over.
+  const bool header_valid = index_file.ReadArray(&header, 1) &&
+                            header.filetype == KEYFRAME_INDEX_MAGIC &&
+                            header.version == KEYFRAME_INDEX_VERSION &&
+                            header.input_size == m_temp_input.size() &&
+                            header.input_hash == m_input_hash &&
+                            header.keyframe_count <= (index_file.GetSize() - sizeof(header)) /
+                                                         sizeof(decltype(m_keyframes)::value_type);
+  if (header_valid)
+  {
+    m_keyframes.resize(header.keyframe_count);
+    if (index_file.ReadArray(m_keyframes.data(), m_keyframes.size()) &&
+        std::is_sorted(m_keyframes.begin(), m_keyframes.end()))
+    {
+      return;
+    }
+    m_keyframes.clear();
+  }
+
+  // Nothing will ever load the savestates of a rejected index, so don't leave them around.
+  index_file.Close();
+  if (!File::DeleteDirRecursively(directory))
+    Core::DisplayMessage(fmt::format("Failed to delete {}", directory), 2000);
+}
+
+void MovieManager::SaveKeyframeIndex() const
+{
+  KeyframeIndexHeader header{};
+  header.filetype = KEYFRAME_INDEX_MAGIC;
+  header.version = KEYFRAME_INDEX_VERSION;
+  header.input_size = m_temp_input.size();
+  header.input_hash = m_input_hash;
+  header.keyframe_count = static_cast<u32>(m_keyframes.size());
+
+  const std::string index_path = GetKeyframeIndexPath();
+  File::IOFile index_file(index_path, "wb");
+  if (!index_file.WriteArray(&header, 1) ||
+      !index_file.WriteArray(m_keyframes.data(), m_keyframes.size()))
+  {
+    Core::DisplayMessage(fmt::format("Failed to save {}", index_path), 2000);
+  }
+}
+
+// NOTE: Host Thread
+void MovieManager::SaveKeyframe()
+{
+  Core::RunOnCPUThread(
+      m_system,
+      [this] {
+        m_keyframe_pending = false;
+        if (!IsPlayingInput() || m_movie_path.empty() || HasKeyframeNear(m_current_frame))
+          return;
+
+        const u64 frame = m_current_frame;
+        const std::string path = GetKeyframePath(frame);
+        File::CreateFullPath(path);
+        if (!State::SaveMovieKeyframe(m_system, path))
+        {
+          // Leave it pending so that this isn't retried on every frame for the rest of playback.
+          m_keyframe_pending = true;
+          Core::DisplayMessage(fmt::format("Failed to save {}", path), 2000);
+          return;
+        }
+
+        m_keyframes.insert(std::upper_bound(m_keyframes.begin(), m_keyframes.end(), frame), frame);
+        SaveKeyframeIndex();
+      },
+      true);
+}
+
+void MovieManager::ClearKeyframeIndex()
+{
+  m_movie_path.clear();
+  m_keyframes.clear();
+  m_keyframe_pending = false;
+  StopSeeking();
+}
+
+std::optional<u64> MovieManager::FindKeyframe(u64 frame) const
+{
+  const auto it = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), frame);
+  if (it == m_keyframes.begin())
+    return std::nullopt;
+  return *std::prev(it);
+}
+
+bool MovieManager::HasKeyframeNear(u64 frame) const
+{
+  const u64 first = frame >= KEYFRAME_INTERVAL ? frame - KEYFRAME_INTERVAL + 1 : 0;
+  const auto it = std::lower_bound(m_keyframes.begin(), m_keyframes.end(), first);
+  return it != m_keyframes.end() && *it < frame + KEYFRAME_INTERVAL;
+}
+
+// Ends a seek started by SeekToFrame, if there is one in progress.
+void MovieManager::StopSeeking()
+{
+  if (!m_seek_target_frame)
+    return;
+
+  m_seek_target_frame.reset();
+  Core::SetIsThrottlerTempDisabled(m_throttler_disabled_before_seek);
+}
+
+// Loads the closest keyframe at or before the given frame if needed, then runs the emulation
+// unthrottled until that frame is reached.
+// NOTE: Host Thread
+bool MovieManager::SeekToFrame(u64 frame)
+{
+  // Loading a keyframe in read-write mode would truncate the movie to it.
+  if (!IsPlayingInput() || !m_read_only || frame > m_total_frames)
+    return false;
+
+  bool success = false;
+  bool needs_replay = false;
+  Core::RunOnCPUThread(
+      m_system,
+      [&] {
+        // Replaying from the current frame is enough unless the target is behind it or there's
+        // a keyframe in between.
+        const std::optional<u64> keyframe = FindKeyframe(frame);
+        if (frame < m_current_frame || (keyframe && *keyframe > m_current_frame))
+        {
+          if (!keyframe || !File::Exists(GetKeyframePath(*keyframe)))
+          {
+            Core::DisplayMessage(fmt::format("No keyframe before frame {}", frame), 2000);
+            return;
+          }
+
+          if (!State::LoadMovieKeyframe(m_system, GetKeyframePath(*keyframe)) ||
+              m_current_frame != *keyframe)
+          {
+            Core::DisplayMessage(fmt::format("Failed to load keyframe {}", *keyframe), 2000);
+            return;
+          }
+        }
+
+        needs_replay = m_current_frame < frame;
+        if (needs_replay)
+        {
+          if (!m_seek_target_frame)
+            m_throttler_disabled_before_seek = Core::GetIsThrottlerTempDisabled();
+          m_seek_target_frame = frame;
+          Core::SetIsThrottlerTempDisabled(true);
+        }
+        else
+        {
+          StopSeeking();
+        }
+        success = true;
+      },
+      true);
+
+  if (needs_replay)
+    Core::SetState(m_system, Core::State::Running);
+  return success;
+}
+
 // NOTE: GPU Thread
 void MovieManager::SetGraphicsConfig()
 {
@@ -1552,5 +1789,6 @@ void MovieManager::Shutdown()
 {
   m_current_input_count = m_total_input_count = m_total_frames = m_tick_count_at_last_input = 0;
   m_temp_input.clear();
+  ClearKeyframeIndex();
 }
 }  // namespace Movie
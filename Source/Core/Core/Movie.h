@@ -215,6 +215,7 @@ public:
                    WiimoteEmu::ExtensionNumber ext, const WiimoteEmu::EncryptionKey& key);
   void EndPlayInput(bool cont);
   void SaveRecording(const std::string& filename);
+  bool SeekToFrame(u64 frame);
   void DoState(PointerWrap& p);
   void Shutdown();
   void CheckPadStatus(const GCPadStatus* PadStatus, int controllerID);
@@ -232,6 +233,17 @@ private:
   void CheckMD5();
   void GetMD5();
 
+  std::string GetKeyframeDirectory() const;
+  std::string GetKeyframeIndexPath() const;
+  std::string GetKeyframePath(u64 frame) const;
+  void LoadKeyframeIndex();
+  void SaveKeyframeIndex() const;
+  void SaveKeyframe();
+  void ClearKeyframeIndex();
+  std::optional<u64> FindKeyframe(u64 frame) const;
+  bool HasKeyframeNear(u64 frame) const;
+  void StopSeeking();
+
   bool m_read_only = true;
   u32 m_rerecords = 0;
   PlayMode m_play_mode = PlayMode::None;
@@ -270,6 +282,15 @@ private:
 
   std::string m_current_file_name;
 
+  // Savestates taken while playing back m_movie_path, sorted by frame. Seeking loads the closest
+  // one instead of replaying the movie from the start.
+  std::string m_movie_path;
+  u32 m_input_hash = 0;
+  std::vector<u64> m_keyframes;
+  bool m_keyframe_pending = false;
+  std::optional<u64> m_seek_target_frame;
+  bool m_throttler_disabled_before_seek = false;
+
   // m_input_display is used by both CPU and GPU (is mutable).
   std::mutex m_input_display_lock;
   std::array<std::string, 8> m_input_display;
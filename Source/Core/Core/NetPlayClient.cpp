@@ -974,6 +974,7 @@ void NetPlayClient::OnPlayerPingData(sf::Packet& packet)
     std::lock_guard lkp(m_crit.players);
     Player& player = m_players[pid];
     packet >> player.ping;
+    player.ping_histogram.AddSample(player.ping);
   }
 
   DisplayPlayersPing();
@@ -1042,6 +1043,7 @@ void NetPlayClient::OnSyncSaveDataNotify(sf::Packet& packet)
 {
   packet >> m_sync_save_data_count;
   m_sync_save_data_success_count = 0;
+  m_received_save_data.pending.clear();
 
   INFO_LOG_FMT(NETPLAY, "Initializing wait for {} savegame chunks.", m_sync_save_data_count);
 
@@ -1085,7 +1087,7 @@ void NetPlayClient::OnSyncSaveDataRaw(sf::Packet& packet)
     return;
   }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = DecompressPacketIntoFile(packet, path, &m_received_save_data);
   SyncSaveDataResponse(success);
 }
 
@@ -1117,7 +1119,7 @@ void NetPlayClient::OnSyncSaveDataGCI(sf::Packet& packet)
     INFO_LOG_FMT(NETPLAY, "Received GCI: {}", file_name);
 
     if (!Common::IsFileNameSafe(file_name) ||
-        !DecompressPacketIntoFile(packet, path + DIR_SEP + file_name))
+        !DecompressPacketIntoFile(packet, path + DIR_SEP + file_name, &m_received_save_data))
     {
       WARN_LOG_FMT(NETPLAY, "Received invalid GCI.");
       SyncSaveDataResponse(false);
@@ -1162,7 +1164,7 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
   {
     INFO_LOG_FMT(NETPLAY, "Received Mii data.");
 
-    auto buffer = DecompressPacketIntoBuffer(packet);
+    auto buffer = DecompressPacketIntoBuffer(packet, &m_received_save_data);
 
     temp_fs->CreateFullPath(IOS::PID_KERNEL, IOS::PID_KERNEL, "/shared2/menu/FaceLib/", 0,
                             fs_modes);
@@ -1241,7 +1243,7 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
 
       if (file.type == WiiSave::Storage::SaveFile::Type::File)
       {
-        auto buffer = DecompressPacketIntoBuffer(packet);
+        auto buffer = DecompressPacketIntoBuffer(packet, &m_received_save_data);
         if (!buffer)
         {
           SyncSaveDataResponse(false);
@@ -1267,7 +1269,7 @@ void NetPlayClient::OnSyncSaveDataWii(sf::Packet& packet)
   if (has_redirected_save)
   {
     INFO_LOG_FMT(NETPLAY, "Received redirected save.");
-    if (!DecompressPacketIntoFolder(packet, redirect_path))
+    if (!DecompressPacketIntoFolder(packet, redirect_path, &m_received_save_data))
     {
       PanicAlertFmtT("Failed to write redirected save.");
       SyncSaveDataResponse(false);
@@ -1296,7 +1298,7 @@ void NetPlayClient::OnSyncSaveDataGBA(sf::Packet& packet)
     return;
   }
 
-  const bool success = DecompressPacketIntoFile(packet, path);
+  const bool success = DecompressPacketIntoFile(packet, path, &m_received_save_data);
   SyncSaveDataResponse(success);
 }
 
@@ -1828,6 +1830,9 @@ void NetPlayClient::SyncSaveDataResponse(const bool success)
   {
     if (++m_sync_save_data_success_count >= m_sync_save_data_count)
     {
+      m_received_save_data.synced = std::move(m_received_save_data.pending);
+      m_received_save_data.pending.clear();
+
       sf::Packet response_packet;
       response_packet << MessageID::SyncSaveData;
       response_packet << SyncSaveDataID::Success;
@@ -1837,6 +1842,9 @@ void NetPlayClient::SyncSaveDataResponse(const bool success)
   }
   else
   {
+    // The host resends everything after a failure
+    m_received_save_data = {};
+
     sf::Packet response_packet;
     response_packet << MessageID::SyncSaveData;
     response_packet << SyncSaveDataID::Failure;
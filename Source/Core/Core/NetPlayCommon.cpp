@@ -4,21 +4,30 @@
 #include "Core/NetPlayCommon.h"
 
 #include <algorithm>
+#include <memory>
 
 #include <fmt/format.h>
-#include <lzo/lzo1x.h>
+#include <zstd.h>
 
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/SFMLHelper.h"
 
+// Every file or buffer is sent as its size, followed (unless it's empty) by the SHA-1 of its
+// contents and a flag telling whether the data itself follows. If it does, it's a single zstd frame
+// split into chunks that are each prefixed with their size, terminated by a chunk of size 0.
+
 namespace NetPlay
 {
-constexpr u32 LZO_IN_LEN = 1024 * 64;
-constexpr u32 LZO_OUT_LEN = LZO_IN_LEN + (LZO_IN_LEN / 16) + 64 + 3;
+constexpr size_t ZSTD_CHUNK_LEN = 128 * 1024;
+constexpr int ZSTD_COMPRESSION_LEVEL = 3;
+// Only has an effect if zstd was built with multithreading support.
+constexpr int ZSTD_WORKERS = 4;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
+bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet,
+                            SentContent* sent_content)
 {
   File::IOFile file(file_path, "rb");
   if (!file)
@@ -27,67 +36,18 @@ bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet)
     return false;
   }
 
-  const sf::Uint64 size = file.GetSize();
-  packet << size;
-
-  if (size == 0)
-    return true;
-
-  std::vector<u8> in_buffer(LZO_IN_LEN);
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
-
-  lzo_uint i = 0;
-  while (true)
+  std::vector<u8> buffer(file.GetSize());
+  if (!file.ReadBytes(buffer.data(), buffer.size()))
   {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
-
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
-
-    if (cur_len <= 0)
-      break;  // EOF
-
-    if (!file.ReadBytes(in_buffer.data(), cur_len))
-    {
-      PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
-      return false;
-    }
-
-    if (lzo1x_1_compress(in_buffer.data(), cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
-      return false;
-    }
-
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
-    {
-      packet << out_buffer[j];
-    }
-
-    if (cur_len != LZO_IN_LEN)
-      break;
-
-    i += cur_len;
+    PanicAlertFmtT("Error reading file: {0}", file_path.c_str());
+    return false;
   }
 
-  // Mark end of data
-  packet << static_cast<u32>(0);
-
-  return true;
+  return CompressBufferIntoPacket(buffer, packet, sent_content);
 }
 
-static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::Packet& packet)
+static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::Packet& packet,
+                                             SentContent* sent_content)
 {
   const sf::Uint64 size = folder.children.size();
   packet << size;
@@ -96,15 +56,17 @@ static bool CompressFolderIntoPacketInternal(const File::FSTEntry& folder, sf::P
     const bool is_folder = child.isDirectory;
     packet << child.virtualName;
     packet << is_folder;
-    const bool success = is_folder ? CompressFolderIntoPacketInternal(child, packet) :
-                                     CompressFileIntoPacket(child.physicalName, packet);
+    const bool success =
+        is_folder ? CompressFolderIntoPacketInternal(child, packet, sent_content) :
+                    CompressFileIntoPacket(child.physicalName, packet, sent_content);
     if (!success)
       return false;
   }
   return true;
 }
 
-bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet)
+bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet,
+                              SentContent* sent_content)
 {
   if (!File::IsDirectory(folder_path))
   {
@@ -113,10 +75,12 @@ bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet
   }
 
   packet << true;
-  return CompressFolderIntoPacketInternal(File::ScanDirectoryTree(folder_path, true), packet);
+  return CompressFolderIntoPacketInternal(File::ScanDirectoryTree(folder_path, true), packet,
+                                          sent_content);
 }
 
-bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet)
+bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet,
+                              SentContent* sent_content)
 {
   const sf::Uint64 size = in_buffer.size();
   packet << size;
@@ -124,46 +88,48 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
   if (size == 0)
     return true;
 
-  std::vector<u8> out_buffer(LZO_OUT_LEN);
-  std::vector<u8> wrkmem(LZO1X_1_MEM_COMPRESS);
+  const ContentHash hash = Common::SHA1::CalculateDigest(in_buffer);
+  packet.append(hash.data(), hash.size());
 
-  lzo_uint i = 0;
-  while (true)
-  {
-    lzo_uint32 cur_len = 0;  // number of bytes to read
-    lzo_uint out_len = 0;    // number of bytes to write
+  if (sent_content)
+    sent_content->pending.insert(hash);
 
-    if ((i + LZO_IN_LEN) >= size)
-    {
-      cur_len = static_cast<lzo_uint32>(size - i);
-    }
-    else
-    {
-      cur_len = LZO_IN_LEN;
-    }
+  // Skip the data if every client already received it in the last sync
+  const bool is_known = sent_content && sent_content->acknowledged.contains(hash);
+  packet << is_known;
+  if (is_known)
+    return true;
 
-    if (cur_len <= 0)
-      break;  // end of buffer
+  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(ZSTD_createCCtx(), ZSTD_freeCCtx);
+  if (!context ||
+      ZSTD_isError(
+          ZSTD_CCtx_setParameter(context.get(), ZSTD_c_compressionLevel, ZSTD_COMPRESSION_LEVEL)) ||
+      ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(context.get(), size)))
+  {
+    PanicAlertFmtT("Internal zstd Error - compression failed");
+    return false;
+  }
+  ZSTD_CCtx_setParameter(context.get(), ZSTD_c_nbWorkers, ZSTD_WORKERS);
 
-    if (lzo1x_1_compress(&in_buffer[i], cur_len, out_buffer.data(), &out_len, wrkmem.data()) !=
-        LZO_E_OK)
+  std::vector<u8> out_buffer(ZSTD_CHUNK_LEN);
+  ZSTD_inBuffer in{in_buffer.data(), in_buffer.size(), 0};
+  size_t remaining;
+  do
+  {
+    ZSTD_outBuffer out{out_buffer.data(), out_buffer.size(), 0};
+    remaining = ZSTD_compressStream2(context.get(), &out, &in, ZSTD_e_end);
+    if (ZSTD_isError(remaining))
     {
-      PanicAlertFmtT("Internal LZO Error - compression failed");
+      PanicAlertFmtT("Internal zstd Error - compression failed");
       return false;
     }
 
-    // The size of the data to write is 'out_len'
-    packet << static_cast<u32>(out_len);
-    for (size_t j = 0; j < out_len; j++)
+    if (out.pos != 0)
     {
-      packet << out_buffer[j];
+      packet << static_cast<u32>(out.pos);
+      packet.append(out_buffer.data(), out.pos);
     }
-
-    if (cur_len != LZO_IN_LEN)
-      break;
-
-    i += cur_len;
-  }
+  } while (remaining != 0);
 
   // Mark end of data
   packet << static_cast<u32>(0);
@@ -171,55 +137,118 @@ bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& pack
   return true;
 }
 
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path)
+static std::optional<std::vector<u8>> DecompressContent(sf::Packet& packet, u64 size,
+                                                        ReceivedContent* received_content)
 {
-  u64 file_size = Common::PacketReadU64(packet);
+  ContentHash hash;
+  for (u8& byte : hash)
+    packet >> byte;
 
-  if (file_size == 0)
-    return true;
-
-  File::IOFile file(file_path, "wb");
-  if (!file)
+  bool is_known = false;
+  packet >> is_known;
+  if (is_known)
   {
-    PanicAlertFmtT("Failed to open file \"{0}\". Verify your write permissions.", file_path);
-    return false;
+    if (received_content)
+    {
+      const auto it = received_content->synced.find(hash);
+      if (it != received_content->synced.end() && it->second.size() == size)
+      {
+        received_content->pending.insert_or_assign(hash, it->second);
+        return it->second;
+      }
+    }
+
+    ERROR_LOG_FMT(NETPLAY, "Host referred to unknown content {}.",
+                  Common::SHA1::DigestToString(hash));
+    return std::nullopt;
   }
 
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-  std::vector<u8> out_buffer(LZO_IN_LEN);
+  std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(ZSTD_createDCtx(), ZSTD_freeDCtx);
+  if (!context)
+  {
+    PanicAlertFmtT("Internal zstd Error - decompression failed");
+    return std::nullopt;
+  }
 
+  std::vector<u8> in_buffer;
+  std::vector<u8> out_buffer(size);
+  ZSTD_outBuffer out{out_buffer.data(), out_buffer.size(), 0};
+  size_t remaining = 1;
   while (true)
   {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
-
+    u32 cur_len = 0;
     packet >> cur_len;
     if (!cur_len)
       break;  // We reached the end of the data stream
 
-    for (size_t j = 0; j < cur_len; j++)
+    if (cur_len > ZSTD_CHUNK_LEN)
     {
-      packet >> in_buffer[j];
+      PanicAlertFmtT("Internal zstd Error - decompression failed");
+      return std::nullopt;
     }
 
-    if (lzo1x_decompress(in_buffer.data(), cur_len, out_buffer.data(), &new_len, nullptr) !=
-        LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return false;
-    }
+    in_buffer.resize(cur_len);
+    for (u8& byte : in_buffer)
+      packet >> byte;
 
-    if (!file.WriteBytes(out_buffer.data(), new_len))
+    ZSTD_inBuffer in{in_buffer.data(), in_buffer.size(), 0};
+    while (in.pos < in.size)
     {
-      PanicAlertFmtT("Error writing file: {0}", file_path);
-      return false;
+      const size_t in_pos = in.pos;
+      const size_t out_pos = out.pos;
+      remaining = ZSTD_decompressStream(context.get(), &out, &in);
+      if (ZSTD_isError(remaining) || (in.pos == in_pos && out.pos == out_pos))
+      {
+        PanicAlertFmtT("Internal zstd Error - decompression failed");
+        return std::nullopt;
+      }
     }
   }
 
+  if (remaining != 0 || out.pos != out.size ||
+      Common::SHA1::CalculateDigest(out_buffer) != hash)
+  {
+    PanicAlertFmtT("Internal zstd Error - decompression failed");
+    return std::nullopt;
+  }
+
+  if (received_content)
+    received_content->pending.insert_or_assign(hash, out_buffer);
+
+  return out_buffer;
+}
+
+bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path,
+                              ReceivedContent* received_content)
+{
+  u64 file_size = Common::PacketReadU64(packet);
+
+  if (file_size == 0)
+    return true;
+
+  const std::optional<std::vector<u8>> data =
+      DecompressContent(packet, file_size, received_content);
+  if (!data)
+    return false;
+
+  File::IOFile file(file_path, "wb");
+  if (!file)
+  {
+    PanicAlertFmtT("Failed to open file \"{0}\". Verify your write permissions.", file_path);
+    return false;
+  }
+
+  if (!file.WriteBytes(data->data(), data->size()))
+  {
+    PanicAlertFmtT("Error writing file: {0}", file_path);
+    return false;
+  }
+
   return true;
 }
 
-static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::string& folder_path)
+static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::string& folder_path,
+                                               ReceivedContent* received_content)
 {
   if (!File::CreateFullPath(folder_path + "/"))
     return false;
@@ -243,58 +272,33 @@ static bool DecompressPacketIntoFolderInternal(sf::Packet& packet, const std::st
     bool is_folder;
     packet >> is_folder;
     std::string path = fmt::format("{}/{}", folder_path, name);
-    const bool success = is_folder ? DecompressPacketIntoFolderInternal(packet, path) :
-                                     DecompressPacketIntoFile(packet, path);
+    const bool success =
+        is_folder ? DecompressPacketIntoFolderInternal(packet, path, received_content) :
+                    DecompressPacketIntoFile(packet, path, received_content);
     if (!success)
       return false;
   }
   return true;
 }
 
-bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path)
+bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path,
+                                ReceivedContent* received_content)
 {
   bool folder_existed;
   packet >> folder_existed;
   if (!folder_existed)
     return true;
-  return DecompressPacketIntoFolderInternal(packet, folder_path);
+  return DecompressPacketIntoFolderInternal(packet, folder_path, received_content);
 }
 
-std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet)
+std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet,
+                                                          ReceivedContent* received_content)
 {
   u64 size = Common::PacketReadU64(packet);
 
-  std::vector<u8> out_buffer(size);
-
   if (size == 0)
-    return out_buffer;
-
-  std::vector<u8> in_buffer(LZO_OUT_LEN);
-
-  lzo_uint i = 0;
-  while (true)
-  {
-    u32 cur_len = 0;       // number of bytes to read
-    lzo_uint new_len = 0;  // number of bytes to write
+    return std::vector<u8>();
 
-    packet >> cur_len;
-    if (!cur_len)
-      break;  // We reached the end of the data stream
-
-    for (size_t j = 0; j < cur_len; j++)
-    {
-      packet >> in_buffer[j];
-    }
-
-    if (lzo1x_decompress(in_buffer.data(), cur_len, &out_buffer[i], &new_len, nullptr) != LZO_E_OK)
-    {
-      PanicAlertFmtT("Internal LZO Error - decompression failed");
-      return {};
-    }
-
-    i += new_len;
-  }
-
-  return out_buffer;
+  return DecompressContent(packet, size, received_content);
 }
 }  // namespace NetPlay
@@ -7,11 +7,14 @@
 
 #include <array>
 #include <chrono>
+#include <map>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Crypto/SHA1.h"
 
 namespace NetPlay
 {
@@ -20,10 +23,38 @@ using namespace std::chrono_literals;
 // connection is disconnected
 constexpr std::chrono::milliseconds PEER_TIMEOUT = 30s;
 
-bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet);
-bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet);
-bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet);
-bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path);
-bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path);
-std::optional<std::vector<u8>> DecompressPacketIntoBuffer(sf::Packet& packet);
+using ContentHash = Common::SHA1::Digest;
+
+// Host side record of the save data of the last sync. Content that every client has acknowledged
+// is only sent as a hash by the next sync.
+struct SentContent
+{
+  std::set<ContentHash> acknowledged;
+  // Content referenced by the sync in progress. It replaces the acknowledged content once every
+  // client has confirmed the sync, just like ReceivedContent does on the clients.
+  std::set<ContentHash> pending;
+  bool sync_in_progress = false;
+};
+
+// Client side copy of the save data of the last sync, used to resolve hashes. Only the content of
+// one sync is kept so that the memory used doesn't grow over a long session.
+struct ReceivedContent
+{
+  std::map<ContentHash, std::vector<u8>> synced;
+  // Content of the sync in progress, which replaces synced once the sync has finished.
+  std::map<ContentHash, std::vector<u8>> pending;
+};
+
+bool CompressFileIntoPacket(const std::string& file_path, sf::Packet& packet,
+                            SentContent* sent_content = nullptr);
+bool CompressFolderIntoPacket(const std::string& folder_path, sf::Packet& packet,
+                              SentContent* sent_content = nullptr);
+bool CompressBufferIntoPacket(const std::vector<u8>& in_buffer, sf::Packet& packet,
+                              SentContent* sent_content = nullptr);
+bool DecompressPacketIntoFile(sf::Packet& packet, const std::string& file_path,
+                              ReceivedContent* received_content = nullptr);
+bool DecompressPacketIntoFolder(sf::Packet& packet, const std::string& folder_path,
+                                ReceivedContent* received_content = nullptr);
+std::optional<std::vector<u8>>
+DecompressPacketIntoBuffer(sf::Packet& packet, ReceivedContent* received_content = nullptr);
 }  // namespace NetPlay
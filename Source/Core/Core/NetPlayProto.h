@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <string>
 #include <vector>
 
@@ -244,6 +246,26 @@ struct GBAConfig
 };
 using GBAConfigArray = std::array<GBAConfig, 4>;
 
+// Latency samples counted in buckets whose upper bounds double every time. The first bucket holds
+// samples below 1 ms and the last one holds everything from 1024 ms up.
+struct LatencyHistogram
+{
+  static constexpr size_t BUCKET_COUNT = 12;
+
+  void AddSample(u32 milliseconds)
+  {
+    ++buckets[std::min<size_t>(std::bit_width(milliseconds), BUCKET_COUNT - 1)];
+  }
+
+  // Lower bound of the given bucket in milliseconds.
+  static constexpr u32 GetBucketStart(size_t bucket)
+  {
+    return bucket == 0 ? 0 : 1u << (bucket - 1);
+  }
+
+  std::array<u32, BUCKET_COUNT> buckets{};
+};
+
 struct PadDetails
 {
   std::string player_name{};
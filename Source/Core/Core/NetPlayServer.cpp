@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <memory>
 #include <mutex>
@@ -87,6 +88,12 @@
 
 namespace NetPlay
 {
+// Chunked data is low priority, so only this many of its packets are handed to ENet per poll tick.
+// This keeps a large transfer from delaying input and other messages queued behind it.
+constexpr size_t CHUNKED_DATA_PACKETS_PER_TICK = 4;
+// Batched input is sent once no events are left, or after this many events at the latest.
+constexpr u32 INPUT_BATCH_MAX_EVENTS = 32;
+
 NetPlayServer::~NetPlayServer()
 {
   if (is_connected)
@@ -248,6 +255,8 @@ void NetPlayServer::ThreadFunc()
 {
   INFO_LOG_FMT(NETPLAY, "NetPlayServer starting.");
 
+  bool has_queued_packets = false;
+  u32 input_batch_events = 0;
   while (m_do_loop)
   {
     // update pings every so many seconds
@@ -261,12 +270,18 @@ void NetPlayServer::ThreadFunc()
       spac << m_ping_key;
 
       m_ping_timer.Start();
+      FlushPendingInput();
       SendToClients(spac);
 
       m_index.SetPlayerCount(static_cast<int>(m_players.size()));
       m_index.SetGame(m_selected_game_name);
       m_index.SetInGame(m_is_running);
 
+      {
+        std::lock_guard lkl(m_crit.queue_latency);
+        m_published_queue_latency = m_queue_latency;
+      }
+
       m_update_pings = false;
     }
 
@@ -274,27 +289,14 @@ void NetPlayServer::ThreadFunc()
     int net;
     if (m_traversal_client)
       m_traversal_client->HandleResends();
-    net = enet_host_service(m_server, &netEvent, 1000);
-    while (!m_async_queue.Empty())
-    {
-      INFO_LOG_FMT(NETPLAY, "Processing async queue event.");
-      {
-        std::lock_guard lkp(m_crit.players);
-        INFO_LOG_FMT(NETPLAY, "Locked player mutex.");
-        auto& e = m_async_queue.Front();
-        if (e.target_mode == TargetMode::Only)
-        {
-          if (m_players.contains(e.target_pid))
-            Send(m_players.at(e.target_pid).socket, e.packet, e.channel_id);
-        }
-        else
-        {
-          SendToClients(e.packet, e.target_pid, e.channel_id);
-        }
-      }
-      INFO_LOG_FMT(NETPLAY, "Processing async queue event done.");
-      m_async_queue.Pop();
-    }
+    // Don't wait for new events while there's still something to send
+    int timeout = 1000;
+    if (!m_pending_input.empty())
+      timeout = 0;
+    else if (has_queued_packets)
+      timeout = 1;
+    net = enet_host_service(m_server, &netEvent, timeout);
+    has_queued_packets = ProcessAsyncQueues();
     if (net > 0)
     {
       switch (netEvent.type)
@@ -322,6 +324,7 @@ void NetPlayServer::ThreadFunc()
             INFO_LOG_FMT(NETPLAY, "Initializing peer {:x}:{}", netEvent.peer->address.host,
                          netEvent.peer->address.port);
             std::lock_guard lkg(m_crit.game);
+            FlushPendingInput();
             error = OnConnect(netEvent.peer, rpac);
           }
 
@@ -349,6 +352,7 @@ void NetPlayServer::ThreadFunc()
 
             // if a bad packet is received, disconnect the client
             std::lock_guard lkg(m_crit.game);
+            FlushPendingInput();
             OnDisconnect(client);
 
             ClearPeerPlayerId(netEvent.peer);
@@ -377,6 +381,7 @@ void NetPlayServer::ThreadFunc()
         {
           Client& client = it->second;
           INFO_LOG_FMT(NETPLAY, "Disconnecting client {}.", client.pid);
+          FlushPendingInput();
           OnDisconnect(client);
 
           ClearPeerPlayerId(netEvent.peer);
@@ -404,6 +409,12 @@ void NetPlayServer::ThreadFunc()
     {
       ERROR_LOG_FMT(NETPLAY, "enet_host_service error: {}", net);
     }
+
+    if (!m_pending_input.empty() && (net <= 0 || ++input_batch_events >= INPUT_BATCH_MAX_EVENTS))
+    {
+      FlushPendingInput();
+      input_batch_events = 0;
+    }
   }
 
   INFO_LOG_FMT(NETPLAY, "NetPlayServer shutting down.");
@@ -498,6 +509,9 @@ ConnectionError NetPlayServer::OnConnect(ENetPeer* incoming_connection, sf::Pack
   if (Config::Get(Config::NETPLAY_ENABLE_QOS))
     new_player.qos_session = Common::QoSSession(new_player.socket);
 
+  // The new player hasn't received any save data yet
+  m_sent_content = {};
+
   {
     std::lock_guard lkp(m_crit.players);
     // add new player to list of players
@@ -705,43 +719,95 @@ void NetPlayServer::SetHostInputAuthority(const bool enable)
 
 void NetPlayServer::SendAsync(sf::Packet&& packet, const PlayerId pid, const u8 channel_id)
 {
-  {
-    std::lock_guard lkq(m_crit.async_queue_write);
-    m_async_queue.Push(AsyncQueueEntry{std::move(packet), pid, TargetMode::Only, channel_id});
-  }
+  m_async_queues[channel_id].Push(AsyncQueueEntry{std::move(packet), pid, TargetMode::Only,
+                                                  std::chrono::steady_clock::now()});
   Common::ENet::WakeupThread(m_server);
 }
 
 void NetPlayServer::SendAsyncToClients(sf::Packet&& packet, const PlayerId skip_pid,
                                        const u8 channel_id)
 {
-  {
-    std::lock_guard lkq(m_crit.async_queue_write);
-    m_async_queue.Push(
-        AsyncQueueEntry{std::move(packet), skip_pid, TargetMode::AllExcept, channel_id});
-  }
+  m_async_queues[channel_id].Push(AsyncQueueEntry{
+      std::move(packet), skip_pid, TargetMode::AllExcept, std::chrono::steady_clock::now()});
   Common::ENet::WakeupThread(m_server);
 }
 
 void NetPlayServer::SendChunked(sf::Packet&& packet, const PlayerId pid, const std::string& title)
 {
-  {
-    std::lock_guard lkq(m_crit.chunked_data_queue_write);
-    m_chunked_data_queue.Push(
-        ChunkedDataQueueEntry{std::move(packet), pid, TargetMode::Only, title});
-  }
+  m_chunked_data_queue.Push(ChunkedDataQueueEntry{std::move(packet), pid, TargetMode::Only, title});
   m_chunked_data_event.Set();
 }
 
 void NetPlayServer::SendChunkedToClients(sf::Packet&& packet, const PlayerId skip_pid,
                                          const std::string& title)
 {
+  m_chunked_data_queue.Push(
+      ChunkedDataQueueEntry{std::move(packet), skip_pid, TargetMode::AllExcept, title});
+  m_chunked_data_event.Set();
+}
+
+// called from ---NETPLAY--- thread
+// Returns whether any packets are left in the queues.
+bool NetPlayServer::ProcessAsyncQueues()
+{
+  const auto now = std::chrono::steady_clock::now();
+  bool has_queued_packets = false;
+
+  std::lock_guard lkp(m_crit.players);
+  for (u8 channel_id = 0; channel_id < CHANNEL_COUNT; ++channel_id)
+  {
+    auto& queue = m_async_queues[channel_id];
+    size_t budget = channel_id == CHUNKED_DATA_CHANNEL ? CHUNKED_DATA_PACKETS_PER_TICK : SIZE_MAX;
+    for (; budget != 0 && !queue.Empty(); --budget)
+    {
+      FlushPendingInput();
+
+      const AsyncQueueEntry& e = queue.Front();
+      const auto latency =
+          std::chrono::duration_cast<std::chrono::milliseconds>(now - e.queued_time);
+      m_queue_latency.AddSample(static_cast<u32>(std::max<s64>(latency.count(), 0)));
+
+      if (e.target_mode == TargetMode::Only)
+      {
+        if (m_players.contains(e.target_pid))
+          Send(m_players.at(e.target_pid).socket, e.packet, channel_id);
+      }
+      else
+      {
+        SendToClients(e.packet, e.target_pid, channel_id);
+      }
+      queue.Pop();
+    }
+    has_queued_packets |= !queue.Empty();
+  }
+
+  return has_queued_packets;
+}
+
+// called from ---NETPLAY--- thread
+void NetPlayServer::FlushPendingInput()
+{
+  for (const auto& [pid, input] : m_pending_input)
   {
-    std::lock_guard lkq(m_crit.chunked_data_queue_write);
-    m_chunked_data_queue.Push(
-        ChunkedDataQueueEntry{std::move(packet), skip_pid, TargetMode::AllExcept, title});
+    if (input.pad_data.getDataSize() != 0)
+    {
+      if (m_host_input_authority)
+      {
+        // Prevent crash before game stop if the golfer disconnects
+        if (input.golfer != 0 && m_players.contains(input.golfer))
+          Send(m_players.at(input.golfer).socket, input.pad_data);
+      }
+      else
+      {
+        SendToClients(input.pad_data, pid);
+      }
+    }
+
+    if (input.wiimote_data.getDataSize() != 0)
+      SendToClients(input.wiimote_data, pid);
   }
-  m_chunked_data_event.Set();
+
+  m_pending_input.clear();
 }
 
 // called from ---NETPLAY--- thread
@@ -753,6 +819,9 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
   INFO_LOG_FMT(NETPLAY, "Got client message: {:x} from client {}", static_cast<u8>(mid),
                player.pid);
 
+  if (mid != MessageID::PadData && mid != MessageID::WiimoteData)
+    FlushPendingInput();
+
   // don't need lock because this is the only thread that modifies the players
   // only need locks for writes to m_players in this thread
 
@@ -803,7 +872,6 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       break;
 
     sf::Packet spac;
-    spac << (m_host_input_authority ? MessageID::PadHostData : MessageID::PadData);
 
     while (!packet.endOfPacket())
     {
@@ -830,16 +898,14 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       }
     }
 
-    if (m_host_input_authority)
+    // Sent out by FlushPendingInput together with anything else this player sends in this tick
+    PendingInput& input = m_pending_input[player.pid];
+    if (input.pad_data.getDataSize() == 0)
     {
-      // Prevent crash before game stop if the golfer disconnects
-      if (m_current_golfer != 0 && m_players.contains(m_current_golfer))
-        Send(m_players.at(m_current_golfer).socket, spac);
-    }
-    else
-    {
-      SendToClients(spac, player.pid);
+      input.pad_data << (m_host_input_authority ? MessageID::PadHostData : MessageID::PadData);
+      input.golfer = m_current_golfer;
     }
+    input.pad_data.append(spac.getData(), spac.getDataSize());
   }
   break;
 
@@ -881,7 +947,6 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       break;
 
     sf::Packet spac;
-    spac << MessageID::WiimoteData;
 
     while (!packet.endOfPacket())
     {
@@ -908,7 +973,10 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
         spac << pad.data[i];
     }
 
-    SendToClients(spac, player.pid);
+    sf::Packet& pending = m_pending_input[player.pid].wiimote_data;
+    if (pending.getDataSize() == 0)
+      pending << MessageID::WiimoteData;
+    pending.append(spac.getData(), spac.getDataSize());
   }
   break;
 
@@ -1152,6 +1220,13 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
                        m_save_data_synced_players, m_players.size() - 1);
           m_dialog->AppendChat(Common::GetStringT("All players' saves synchronized."));
 
+          {
+            std::lock_guard lkg(m_crit.game);
+            m_sent_content.acknowledged = std::move(m_sent_content.pending);
+            m_sent_content.pending.clear();
+            m_sent_content.sync_in_progress = false;
+          }
+
           // Saves are synced, check if codes are as well and attempt to start the game
           m_saves_synced = true;
           CheckSyncAndStartGame();
@@ -1175,6 +1250,10 @@ unsigned int NetPlayServer::OnData(sf::Packet& packet, Client& player)
       m_dialog->OnGameStartAborted();
       ChunkedDataAbort();
       m_start_pending = false;
+
+      // The client might be missing data that we assumed it had, so resend everything next time
+      std::lock_guard lkg(m_crit.game);
+      m_sent_content = {};
     }
     break;
 
@@ -1799,6 +1878,18 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
 
   m_save_data_synced_players = 0;
 
+  SentContent sent_content;
+  {
+    std::lock_guard lkg(m_crit.game);
+    // Clients replace their content when they finish a sync, so if the last one never finished on
+    // this end it's unknown which content they still have.
+    if (m_sent_content.sync_in_progress)
+      m_sent_content.acknowledged.clear();
+    m_sent_content.pending.clear();
+    m_sent_content.sync_in_progress = true;
+    sent_content.acknowledged = m_sent_content.acknowledged;
+  }
+
   {
     sf::Packet pac;
     pac << MessageID::SyncSaveData;
@@ -1838,7 +1929,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of raw memcard {} in slot {}.", path,
                      is_slot_a ? 'A' : 'B');
-        if (!CompressFileIntoPacket(path, pac))
+        if (!CompressFileIntoPacket(path, pac, &sent_content))
           return false;
       }
       else
@@ -1877,7 +1968,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
           const std::string filename = file.substr(file.find_last_of('/') + 1);
           INFO_LOG_FMT(NETPLAY, "Sending GCI {}.", filename);
           pac << filename;
-          if (!CompressFileIntoPacket(file, pac))
+          if (!CompressFileIntoPacket(file, pac, &sent_content))
             return false;
         }
       }
@@ -1905,7 +1996,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
     {
       INFO_LOG_FMT(NETPLAY, "Sending Mii data.");
       pac << true;
-      if (!CompressBufferIntoPacket(*sync_info.mii_data, pac))
+      if (!CompressBufferIntoPacket(*sync_info.mii_data, pac, &sent_content))
         return false;
     }
     else
@@ -1966,7 +2057,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
           if (file.type == WiiSave::Storage::SaveFile::Type::File)
           {
             const std::optional<std::vector<u8>>& data = *file.data;
-            if (!data || !CompressBufferIntoPacket(*data, pac))
+            if (!data || !CompressBufferIntoPacket(*data, pac, &sent_content))
               return false;
           }
         }
@@ -1983,7 +2074,8 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       INFO_LOG_FMT(NETPLAY, "Sending redirected save at {}.",
                    sync_info.redirected_save->m_target_path);
       pac << true;
-      if (!CompressFolderIntoPacket(sync_info.redirected_save->m_target_path, pac))
+      if (!CompressFolderIntoPacket(sync_info.redirected_save->m_target_path, pac,
+                                    &sent_content))
         return false;
     }
     else
@@ -2012,7 +2104,7 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
       if (File::Exists(path))
       {
         INFO_LOG_FMT(NETPLAY, "Sending data of GBA save at {} for slot {}.", path, i);
-        if (!CompressFileIntoPacket(path, pac))
+        if (!CompressFileIntoPacket(path, pac, &sent_content))
           return false;
       }
       else
@@ -2027,6 +2119,11 @@ bool NetPlayServer::SyncSaveData(const SaveSyncInfo& sync_info)
     }
   }
 
+  {
+    std::lock_guard lkg(m_crit.game);
+    m_sent_content.pending = std::move(sent_content.pending);
+  }
+
   return true;
 }
 
@@ -2278,6 +2375,12 @@ void NetPlayServer::SendResponseToAllPlayers(const MessageID message_id, Data&&.
   SendToClients(response);
 }
 
+LatencyHistogram NetPlayServer::GetQueueLatency() const
+{
+  std::lock_guard lkl(m_crit.queue_latency);
+  return m_published_queue_latency;
+}
+
 u16 NetPlayServer::GetPort() const
 {
   return m_server->address.port;
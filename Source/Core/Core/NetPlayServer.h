@@ -5,6 +5,8 @@
 
 #include <SFML/Network/Packet.hpp>
 
+#include <array>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -17,10 +19,11 @@
 #include <utility>
 
 #include "Common/Event.h"
+#include "Common/MPSCQueue.h"
 #include "Common/QoSSession.h"
-#include "Common/SPSCQueue.h"
 #include "Common/Timer.h"
 #include "Common/TraversalClient.h"
+#include "Core/NetPlayCommon.h"
 #include "Core/NetPlayProto.h"
 #include "Core/SyncIdentifier.h"
 #include "InputCommon/GCPadStatus.h"
@@ -73,6 +76,9 @@ public:
 
   u16 GetPort() const;
 
+  // Time packets spent in the send queues before being handed to ENet, updated every second.
+  LatencyHistogram GetQueueLatency() const;
+
   std::unordered_set<std::string> GetInterfaceSet() const;
   std::string GetInterfaceHost(const std::string& inter) const;
 
@@ -110,7 +116,17 @@ private:
     sf::Packet packet;
     PlayerId target_pid{};
     TargetMode target_mode{};
-    u8 channel_id = 0;
+    std::chrono::steady_clock::time_point queued_time{};
+  };
+
+  // Input received during the current poll tick, batched per sender. Any other message is only
+  // sent after the batch, so that clients see everything in the order it was received.
+  struct PendingInput
+  {
+    sf::Packet pad_data;
+    sf::Packet wiimote_data;
+    // The golfer when pad_data was received, who gets it in host input authority mode
+    PlayerId golfer = 0;
   };
 
   struct ChunkedDataQueueEntry
@@ -140,6 +156,8 @@ private:
   ConnectionError OnConnect(ENetPeer* socket, sf::Packet& received_packet);
   unsigned int OnDisconnect(const Client& player);
   unsigned int OnData(sf::Packet& packet, Client& player);
+  bool ProcessAsyncQueues();
+  void FlushPendingInput();
 
   void OnTraversalStateChanged() override;
   void OnConnectReady(ENetAddress) override {}
@@ -179,6 +197,8 @@ private:
   bool m_saves_synced = true;
   bool m_codes_synced = true;
   bool m_start_pending = false;
+  // Guarded by m_crit.game
+  SentContent m_sent_content;
   bool m_host_input_authority = false;
   PlayerId m_current_golfer = 1;
   PlayerId m_pending_golfer = 0;
@@ -193,12 +213,14 @@ private:
     std::recursive_mutex game;
     // lock order
     std::recursive_mutex players;
-    std::recursive_mutex async_queue_write;
-    std::recursive_mutex chunked_data_queue_write;
+    mutable std::mutex queue_latency;
   } m_crit;
 
-  Common::SPSCQueue<AsyncQueueEntry, false> m_async_queue;
-  Common::SPSCQueue<ChunkedDataQueueEntry, false> m_chunked_data_queue;
+  std::array<Common::MPSCQueue<AsyncQueueEntry>, CHANNEL_COUNT> m_async_queues;
+  Common::MPSCQueue<ChunkedDataQueueEntry> m_chunked_data_queue;
+  std::map<PlayerId, PendingInput> m_pending_input;
+  LatencyHistogram m_queue_latency;
+  LatencyHistogram m_published_queue_latency;
 
   SyncIdentifier m_selected_game_identifier;
   std::string m_selected_game_name;
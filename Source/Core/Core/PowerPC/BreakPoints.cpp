@@ -287,8 +287,6 @@ void MemChecks::AddFromStrings(const TMemChecksStr& mc_strings)
 
 void MemChecks::Add(TMemCheck memory_check)
 {
-  bool had_any = HasAny();
-
   const Core::CPUThreadGuard guard(m_system);
   // Check for existing breakpoint, and overwrite with new info.
   // This is assuming we usually want the new breakpoint over an old one.
@@ -306,11 +304,7 @@ void MemChecks::Add(TMemCheck memory_check)
   {
     m_mem_checks.emplace_back(std::move(memory_check));
   }
-  // If this is the first one, clear the JIT cache so it can switch to
-  // watchpoint-compatible code.
-  if (!had_any)
-    m_system.GetJitInterface().ClearCache(guard);
-  m_system.GetMMU().DBATUpdated();
+  OnMemChecksChanged(guard);
 }
 
 bool MemChecks::ToggleEnable(u32 address)
@@ -336,9 +330,7 @@ bool MemChecks::Remove(u32 address)
 
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.erase(iter);
-  if (!HasAny())
-    m_system.GetJitInterface().ClearCache(guard);
-  m_system.GetMMU().DBATUpdated();
+  OnMemChecksChanged(guard);
   return true;
 }
 
@@ -346,12 +338,50 @@ void MemChecks::Clear()
 {
   const Core::CPUThreadGuard guard(m_system);
   m_mem_checks.clear();
+  OnMemChecksChanged(guard);
+}
+
+void MemChecks::OnMemChecksChanged(const Core::CPUThreadGuard& guard)
+{
+  UpdateWatchedPages();
+
+  // The JIT skips memchecks entirely for accesses to constant addresses in unwatched pages, so
+  // the cache has to be cleared whenever the set of watched pages may have changed.
   m_system.GetJitInterface().ClearCache(guard);
   m_system.GetMMU().DBATUpdated();
 }
 
+void MemChecks::UpdateWatchedPages()
+{
+  constexpr size_t num_pages = size_t{1} << (32 - WATCHED_PAGE_SHIFT);
+  m_watched_pages.assign(m_mem_checks.empty() ? 0 : num_pages / 64, 0);
+
+  for (const TMemCheck& mc : m_mem_checks)
+  {
+    const u32 last_page = mc.end_address >> WATCHED_PAGE_SHIFT;
+    for (u32 page = mc.start_address >> WATCHED_PAGE_SHIFT; page <= last_page; ++page)
+      m_watched_pages[page / 64] |= u64{1} << (page % 64);
+  }
+}
+
+bool MemChecks::IsPageWatched(u32 address) const
+{
+  if (m_watched_pages.empty())
+    return false;
+
+  const u32 page = address >> WATCHED_PAGE_SHIFT;
+  return (m_watched_pages[page / 64] >> (page % 64)) & 1;
+}
+
 TMemCheck* MemChecks::GetMemCheck(u32 address, size_t size)
 {
+  // Most accesses don't touch a watched page, so check that before going through the memchecks.
+  if (size <= WATCHED_PAGE_SIZE && !IsPageWatched(address) &&
+      !IsPageWatched(static_cast<u32>(address + size - 1)))
+  {
+    return nullptr;
+  }
+
   const auto iter =
       std::find_if(m_mem_checks.begin(), m_mem_checks.end(), [address, size](const auto& mc) {
         return mc.end_address >= address && address + size - 1 >= mc.start_address;
@@ -372,6 +402,21 @@ bool MemChecks::OverlapsMemcheck(u32 address, u32 length) const
   const u32 page_end_suffix = length - 1;
   const u32 page_end_address = address | page_end_suffix;
 
+  // Blocks made of whole pages overlap a memcheck exactly when one of their pages is watched.
+  if (length >= WATCHED_PAGE_SIZE && (length & page_end_suffix) == 0)
+  {
+    const u32 last_page = page_end_address >> WATCHED_PAGE_SHIFT;
+    for (u32 page = (address & ~page_end_suffix) >> WATCHED_PAGE_SHIFT; page <= last_page; ++page)
+    {
+      if (IsPageWatched(page << WATCHED_PAGE_SHIFT))
+        return true;
+    }
+    return false;
+  }
+
+  if (!IsPageWatched(address))
+    return false;
+
   return std::any_of(m_mem_checks.cbegin(), m_mem_checks.cend(), [&](const auto& mc) {
     return ((mc.start_address | page_end_suffix) == page_end_address ||
             (mc.end_address | page_end_suffix) == page_end_address) ||
@@ -13,6 +13,7 @@
 
 namespace Core
 {
+class CPUThreadGuard;
 class System;
 }
 
@@ -121,6 +122,9 @@ public:
 
   TMemCheck* GetMemCheck(u32 address, size_t size = 1);
   bool OverlapsMemcheck(u32 address, u32 length) const;
+  // Whether any memcheck overlaps the 4 KiB page containing the given address. This is cheap
+  // enough to be called for every memory access.
+  bool IsPageWatched(u32 address) const;
   // Remove Breakpoint. Returns whether it was removed.
   bool Remove(u32 address);
 
@@ -128,6 +132,16 @@ public:
   bool HasAny() const { return !m_mem_checks.empty(); }
 
 private:
+  static constexpr u32 WATCHED_PAGE_SHIFT = 12;
+  static constexpr u32 WATCHED_PAGE_SIZE = 1 << WATCHED_PAGE_SHIFT;
+
+  void UpdateWatchedPages();
+  void OnMemChecksChanged(const Core::CPUThreadGuard& guard);
+
   TMemChecks m_mem_checks;
+  // One bit for each page of the effective address space that a memcheck overlaps, so that
+  // accesses to all other pages don't have to look at the memchecks at all. Empty if there are no
+  // memchecks.
+  std::vector<u64> m_watched_pages;
   Core::System& m_system;
 };
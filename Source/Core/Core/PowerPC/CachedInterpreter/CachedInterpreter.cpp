@@ -3,6 +3,9 @@
 
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 
+#include <bit>
+#include <type_traits>
+
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
 #include "Core/ConfigManager.h"
@@ -17,6 +20,9 @@
 #include "Core/PowerPC/PowerPC.h"
 #include "Core/System.h"
 
+// Pre-decoded operands refer to this instead of a GPR when an instruction uses rA = 0 as zero.
+static constexpr u32 ZERO_REGISTER = 0;
+
 CachedInterpreter::CachedInterpreter(Core::System& system) : JitBase(system), m_block_cache(*this)
 {
 }
@@ -197,6 +203,65 @@ s32 CachedInterpreter::CheckIdle(PowerPC::PowerPCState& ppc_state,
   return sizeof(AnyCallback) + sizeof(operands);
 }
 
+s32 CachedInterpreter::AddImmediate(PowerPC::PowerPCState& ppc_state,
+                                    const AddImmediateOperands& operands)
+{
+  const auto& [a, rd, imm] = operands;
+  ppc_state.gpr[rd] = a + imm;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::RotateAndMask(PowerPC::PowerPCState& ppc_state,
+                                     const RotateAndMaskOperands& operands)
+{
+  const auto& [ra, rs, sh, mask] = operands;
+  ppc_state.gpr[ra] = std::rotl(ppc_state.gpr[rs], sh) & mask;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <bool is_signed>
+s32 CachedInterpreter::CompareImmediate(PowerPC::PowerPCState& ppc_state,
+                                        const CompareImmediateOperands& operands)
+{
+  const auto& [ra, imm, crf] = operands;
+  using T = std::conditional_t<is_signed, s32, u32>;
+  const T a = static_cast<T>(ppc_state.gpr[ra]);
+  const T b = static_cast<T>(imm);
+
+  u32 cr_field = a < b ? PowerPC::CR_LT : a > b ? PowerPC::CR_GT : PowerPC::CR_EQ;
+  if (ppc_state.GetXER_SO())
+    cr_field |= PowerPC::CR_SO;
+  ppc_state.cr.SetField(crf, cr_field);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::LoadWord(PowerPC::PowerPCState& ppc_state,
+                                const LoadStoreWordOperands& operands)
+{
+  const auto& [mmu, a, rd, offset] = operands;
+  const u32 value = mmu.Read_U32(a + offset);
+  if (!(ppc_state.Exceptions & EXCEPTION_DSI))
+    ppc_state.gpr[rd] = value;
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+s32 CachedInterpreter::StoreWord(PowerPC::PowerPCState& ppc_state,
+                                 const LoadStoreWordOperands& operands)
+{
+  const auto& [mmu, a, rs, offset] = operands;
+  mmu.Write_U32(ppc_state.gpr[rs], a + offset);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
+template <auto first, auto second, class FirstOperands, class SecondOperands>
+s32 CachedInterpreter::Fused(PowerPC::PowerPCState& ppc_state,
+                             const FusedOperands<FirstOperands, SecondOperands>& operands)
+{
+  first(ppc_state, operands.first);
+  second(ppc_state, operands.second);
+  return sizeof(AnyCallback) + sizeof(operands);
+}
+
 bool CachedInterpreter::HandleFunctionHooking(u32 address)
 {
   // CachedInterpreter inherits from JitBase and is considered a JIT by relevant code.
@@ -315,6 +380,146 @@ void CachedInterpreter::Jit(u32 em_address, bool clear_cache_and_retry_on_failur
   std::exit(-1);
 }
 
+bool CachedInterpreter::ShouldCheckExceptions(const PPCAnalyst::CodeOp& op)
+{
+  // Instruction may cause a DSI Exception or Program Exception.
+  return (jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
+         (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op));
+}
+
+bool CachedInterpreter::CanFuseWithPrevious(const PPCAnalyst::CodeOp& op)
+{
+  // Nothing may need to be written between the two instructions.
+  return !op.skip && !IsDebuggingEnabled() && (op.opinfo->flags & FL_USE_FPU) == 0 &&
+         !ShouldCheckExceptions(op) &&
+         !HLE::TryReplaceFunction(m_ppc_symbol_db, op.address, PowerPC::CoreMode::JIT);
+}
+
+namespace
+{
+bool IsAddImmediate(UGeckoInstruction inst)
+{
+  return inst.OPCD == 14 || inst.OPCD == 15;  // addi, addis
+}
+
+bool IsRotateAndMask(UGeckoInstruction inst)
+{
+  return inst.OPCD == 21 && !inst.Rc;  // rlwinm
+}
+
+bool IsCompareImmediate(UGeckoInstruction inst)
+{
+  return inst.OPCD == 10 || inst.OPCD == 11;  // cmpli, cmpi
+}
+
+bool IsLoadWord(UGeckoInstruction inst)
+{
+  return inst.OPCD == 32;  // lwz
+}
+
+bool IsStoreWord(UGeckoInstruction inst)
+{
+  return inst.OPCD == 36;  // stw
+}
+
+bool IsBranchConditional(UGeckoInstruction inst)
+{
+  return inst.OPCD == 16;  // bc
+}
+}  // namespace
+
+bool CachedInterpreter::WritePredecodedInstruction(const PPCAnalyst::CodeOp& op)
+{
+  const UGeckoInstruction inst = op.inst;
+  const u32& a = inst.RA ? m_ppc_state.gpr[inst.RA] : ZERO_REGISTER;
+
+  if (IsAddImmediate(inst))
+  {
+    const u32 imm = inst.OPCD == 15 ? u32(inst.SIMM_16) << 16 : u32(inst.SIMM_16);
+    Write(AddImmediate, {a, inst.RD, imm});
+  }
+  else if (IsRotateAndMask(inst))
+  {
+    Write(RotateAndMask, {inst.RA, inst.RS, inst.SH, MakeRotationMask(inst.MB, inst.ME)});
+  }
+  else if (IsCompareImmediate(inst))
+  {
+    if (inst.OPCD == 11)
+      Write(CompareImmediate<true>, {inst.RA, u32(inst.SIMM_16), inst.CRFD});
+    else
+      Write(CompareImmediate<false>, {inst.RA, inst.UIMM, inst.CRFD});
+  }
+  else if (IsLoadWord(inst))
+  {
+    Write(LoadWord, {m_mmu, a, inst.RD, u32(inst.SIMM_16)});
+  }
+  else if (IsStoreWord(inst))
+  {
+    Write(StoreWord, {m_mmu, a, inst.RS, u32(inst.SIMM_16)});
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+bool CachedInterpreter::WriteFusedInstructions(const PPCAnalyst::CodeOp& op,
+                                               const PPCAnalyst::CodeOp& next_op)
+{
+  if (op.canEndBlock || !CanFuseWithPrevious(next_op))
+    return false;
+
+  const UGeckoInstruction inst = op.inst;
+  const UGeckoInstruction next_inst = next_op.inst;
+
+  if (IsLoadWord(inst) && IsAddImmediate(next_inst))
+  {
+    using Operands = FusedOperands<LoadStoreWordOperands, AddImmediateOperands>;
+    const u32& a = inst.RA ? m_ppc_state.gpr[inst.RA] : ZERO_REGISTER;
+    const u32& next_a = next_inst.RA ? m_ppc_state.gpr[next_inst.RA] : ZERO_REGISTER;
+    const u32 imm =
+        next_inst.OPCD == 15 ? u32(next_inst.SIMM_16) << 16 : u32(next_inst.SIMM_16);
+    Write(Fused<LoadWord, AddImmediate, LoadStoreWordOperands, AddImmediateOperands>,
+          Operands{{m_mmu, a, inst.RD, u32(inst.SIMM_16)}, {next_a, next_inst.RD, imm}});
+    return true;
+  }
+
+  if (IsRotateAndMask(inst) && IsStoreWord(next_inst))
+  {
+    using Operands = FusedOperands<RotateAndMaskOperands, LoadStoreWordOperands>;
+    const u32& next_a = next_inst.RA ? m_ppc_state.gpr[next_inst.RA] : ZERO_REGISTER;
+    Write(Fused<RotateAndMask, StoreWord, RotateAndMaskOperands, LoadStoreWordOperands>,
+          Operands{{inst.RA, inst.RS, inst.SH, MakeRotationMask(inst.MB, inst.ME)},
+                   {m_mmu, next_a, next_inst.RS, u32(next_inst.SIMM_16)}});
+    return true;
+  }
+
+  if (IsCompareImmediate(inst) && IsBranchConditional(next_inst))
+  {
+    using Operands = FusedOperands<CompareImmediateOperands, InterpretOperands>;
+    const InterpretOperands branch = {m_system.GetInterpreter(),
+                                      Interpreter::GetInterpreterOp(next_inst), next_op.address,
+                                      next_inst};
+    // bc can end the block, so it needs pc and npc to be written.
+    if (inst.OPCD == 11)
+    {
+      Write(Fused<CompareImmediate<true>, Interpret<true>, CompareImmediateOperands,
+                  InterpretOperands>,
+            Operands{{inst.RA, u32(inst.SIMM_16), inst.CRFD}, branch});
+    }
+    else
+    {
+      Write(Fused<CompareImmediate<false>, Interpret<true>, CompareImmediateOperands,
+                  InterpretOperands>,
+            Operands{{inst.RA, inst.UIMM, inst.CRFD}, branch});
+    }
+    return true;
+  }
+
+  return false;
+}
+
 bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
 {
   js.blockStart = em_address;
@@ -333,6 +538,9 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     Write(StartProfiledBlock, {js.curBlock->profile_data.get()});
 
+  // Set when the previous instruction was written together with this one.
+  bool fused_with_previous = false;
+
   for (u32 i = 0; i < code_block.m_num_instructions; i++)
   {
     PPCAnalyst::CodeOp& op = m_code_buffer[i];
@@ -362,9 +570,11 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
         js.firstFPInstructionFound = true;
       }
 
-      // Instruction may cause a DSI Exception or Program Exception.
-      if ((jo.memcheck && (op.opinfo->flags & FL_LOADSTORE) != 0) ||
-          (!op.canEndBlock && ShouldHandleFPExceptionForInstruction(&op)))
+      if (fused_with_previous)
+      {
+        fused_with_previous = false;
+      }
+      else if (ShouldCheckExceptions(op))
       {
         const InterpretAndCheckExceptionsOperands operands = {
             {interpreter, Interpreter::GetInterpreterOp(op.inst), js.compilerPC, op.inst},
@@ -374,7 +584,12 @@ bool CachedInterpreter::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
                                InterpretAndCheckExceptions<false>,
               operands);
       }
-      else
+      else if (i + 1 < code_block.m_num_instructions &&
+               WriteFusedInstructions(op, m_code_buffer[i + 1]))
+      {
+        fused_with_previous = true;
+      }
+      else if (op.canEndBlock || !WritePredecodedInstruction(op))
       {
         const InterpretOperands operands = {interpreter, Interpreter::GetInterpreterOp(op.inst),
                                             js.compilerPC, op.inst};
@@ -56,6 +56,15 @@ private:
   bool HandleFunctionHooking(u32 address);
   void WriteEndBlock();
 
+  bool ShouldCheckExceptions(const PPCAnalyst::CodeOp& op);
+  bool CanFuseWithPrevious(const PPCAnalyst::CodeOp& op);
+  // Writes a callback with pre-decoded operands for common instructions that can't end the block
+  // or raise exceptions. Returns false if the instruction isn't one of them.
+  bool WritePredecodedInstruction(const PPCAnalyst::CodeOp& op);
+  // Writes a single callback that executes both instructions. Returns false if there is no fused
+  // callback for the pair.
+  bool WriteFusedInstructions(const PPCAnalyst::CodeOp& op, const PPCAnalyst::CodeOp& next_op);
+
   // Finds a free memory region and sets the code emitter to point at that region.
   // Returns false if no free memory region can be found.
   bool SetEmitterStateToFreeCodeRegion();
@@ -72,6 +81,12 @@ private:
   struct WriteBrokenBlockNPCOperands;
   struct CheckHaltOperands;
   struct CheckIdleOperands;
+  struct AddImmediateOperands;
+  struct RotateAndMaskOperands;
+  struct CompareImmediateOperands;
+  struct LoadStoreWordOperands;
+  template <class FirstOperands, class SecondOperands>
+  struct FusedOperands;
 
   static s32 StartProfiledBlock(PowerPC::PowerPCState& ppc_state,
                                 const StartProfiledBlockOperands& profile_data);
@@ -89,6 +104,18 @@ private:
   static s32 CheckBreakpoint(PowerPC::PowerPCState& ppc_state, const CheckHaltOperands& operands);
   static s32 CheckIdle(PowerPC::PowerPCState& ppc_state, const CheckIdleOperands& operands);
 
+  static s32 AddImmediate(PowerPC::PowerPCState& ppc_state, const AddImmediateOperands& operands);
+  static s32 RotateAndMask(PowerPC::PowerPCState& ppc_state,
+                           const RotateAndMaskOperands& operands);
+  template <bool is_signed>
+  static s32 CompareImmediate(PowerPC::PowerPCState& ppc_state,
+                              const CompareImmediateOperands& operands);
+  static s32 LoadWord(PowerPC::PowerPCState& ppc_state, const LoadStoreWordOperands& operands);
+  static s32 StoreWord(PowerPC::PowerPCState& ppc_state, const LoadStoreWordOperands& operands);
+  template <auto first, auto second, class FirstOperands, class SecondOperands>
+  static s32 Fused(PowerPC::PowerPCState& ppc_state,
+                   const FusedOperands<FirstOperands, SecondOperands>& operands);
+
   HyoutaUtilities::RangeSizeSet<u8*> m_free_ranges;
   CachedInterpreterBlockCache m_block_cache;
 };
@@ -152,3 +179,45 @@ struct CachedInterpreter::CheckIdleOperands
   CoreTiming::CoreTimingManager& core_timing;
   u32 idle_pc;
 };
+
+// addi, addis
+struct CachedInterpreter::AddImmediateOperands
+{
+  const u32& a;  // Refers to a constant zero if rA is 0
+  u32 rd;
+  u32 imm;
+};
+
+// rlwinm without Rc
+struct CachedInterpreter::RotateAndMaskOperands
+{
+  u32 ra;
+  u32 rs;
+  u32 sh;
+  u32 mask;
+};
+
+// cmpi, cmpli
+struct CachedInterpreter::CompareImmediateOperands
+{
+  u32 ra;
+  u32 imm;
+  u32 crf;
+  u32 : 32;
+};
+
+// lwz, stw
+struct CachedInterpreter::LoadStoreWordOperands
+{
+  PowerPC::MMU& mmu;
+  const u32& a;  // Refers to a constant zero if rA is 0
+  u32 rds;
+  u32 offset;
+};
+
+template <class FirstOperands, class SecondOperands>
+struct CachedInterpreter::FusedOperands
+{
+  FirstOperands first;
+  SecondOperands second;
+};
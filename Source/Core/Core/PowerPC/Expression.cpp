@@ -399,6 +399,269 @@ Expression::Expression(std::string_view text, ExprPointer ex, ExprVarListPointer
     else
       m_binds.emplace_back();
   }
+
+  if (!Compile(*m_expr, 0))
+    m_program.clear();
+}
+
+bool Expression::Compile(const expr& node, size_t depth)
+{
+  if (depth >= MAX_STACK_DEPTH)
+    return false;
+
+  const auto compile_unary = [&](Opcode opcode) {
+    if (!Compile(node.param.op.args.buf[0], depth))
+      return false;
+    m_program.push_back({opcode});
+    return true;
+  };
+  const auto compile_binary = [&](Opcode opcode) {
+    if (!Compile(node.param.op.args.buf[0], depth) ||
+        !Compile(node.param.op.args.buf[1], depth + 1))
+    {
+      return false;
+    }
+    m_program.push_back({opcode});
+    return true;
+  };
+  const auto compile_logical = [&](Opcode skip_opcode) {
+    if (!Compile(node.param.op.args.buf[0], depth))
+      return false;
+    const size_t skip_index = m_program.size();
+    m_program.push_back({skip_opcode});
+    if (!Compile(node.param.op.args.buf[1], depth))
+      return false;
+    m_program.push_back({Opcode::TruthyOrZero});
+    m_program[skip_index].operand = static_cast<int>(m_program.size());
+    return true;
+  };
+
+  switch (node.type)
+  {
+  case OP_CONST:
+    m_program.push_back({Opcode::Const, 0, node.param.num.value});
+    return true;
+  case OP_VAR:
+  {
+    auto bind = m_binds.begin();
+    for (auto* v = m_vars->head; v != nullptr; v = v->next, ++bind)
+    {
+      if (&v->value != node.param.var.value)
+        continue;
+
+      switch (bind->type)
+      {
+      case VarBindingType::Zero:
+        // Nothing can assign to these in a compiled expression.
+        m_program.push_back({Opcode::Const});
+        break;
+      case VarBindingType::GPR:
+        m_program.push_back({Opcode::LoadGPR, bind->index});
+        break;
+      case VarBindingType::FPR:
+        m_program.push_back({Opcode::LoadFPR, bind->index});
+        break;
+      case VarBindingType::SPR:
+        m_program.push_back({Opcode::LoadSPR, bind->index});
+        break;
+      case VarBindingType::PCtr:
+        m_program.push_back({Opcode::LoadPC});
+        break;
+      case VarBindingType::MSR:
+        m_program.push_back({Opcode::LoadMSR});
+        break;
+      }
+      return true;
+    }
+    return false;
+  }
+  case OP_UNARY_MINUS:
+    return compile_unary(Opcode::Negate);
+  case OP_UNARY_LOGICAL_NOT:
+    return compile_unary(Opcode::LogicalNot);
+  case OP_UNARY_BITWISE_NOT:
+    return compile_unary(Opcode::BitwiseNot);
+  case OP_POWER:
+    return compile_binary(Opcode::Power);
+  case OP_MULTIPLY:
+    return compile_binary(Opcode::Multiply);
+  case OP_DIVIDE:
+    return compile_binary(Opcode::Divide);
+  case OP_REMAINDER:
+    return compile_binary(Opcode::Remainder);
+  case OP_PLUS:
+    return compile_binary(Opcode::Add);
+  case OP_MINUS:
+    return compile_binary(Opcode::Subtract);
+  case OP_SHL:
+    return compile_binary(Opcode::ShiftLeft);
+  case OP_SHR:
+    return compile_binary(Opcode::ShiftRight);
+  case OP_LT:
+    return compile_binary(Opcode::Less);
+  case OP_LE:
+    return compile_binary(Opcode::LessEqual);
+  case OP_GT:
+    return compile_binary(Opcode::Greater);
+  case OP_GE:
+    return compile_binary(Opcode::GreaterEqual);
+  case OP_EQ:
+    return compile_binary(Opcode::Equal);
+  case OP_NE:
+    return compile_binary(Opcode::NotEqual);
+  case OP_BITWISE_AND:
+    return compile_binary(Opcode::BitwiseAnd);
+  case OP_BITWISE_OR:
+    return compile_binary(Opcode::BitwiseOr);
+  case OP_BITWISE_XOR:
+    return compile_binary(Opcode::BitwiseXor);
+  case OP_LOGICAL_AND:
+    return compile_logical(Opcode::SkipIfFalse);
+  case OP_LOGICAL_OR:
+    return compile_logical(Opcode::SkipIfTrue);
+  case OP_COMMA:
+    if (!Compile(node.param.op.args.buf[0], depth))
+      return false;
+    m_program.push_back({Opcode::Discard});
+    return Compile(node.param.op.args.buf[1], depth);
+  default:
+    // Function calls and assignments have side effects that only the interpreter handles.
+    return false;
+  }
+}
+
+double Expression::Run(Core::System& system) const
+{
+  // The semantics of every operation must exactly match expr_eval.
+  const auto& ppc_state = system.GetPPCState();
+  std::array<double, MAX_STACK_DEPTH> stack;
+  size_t sp = 0;
+
+  const auto binary = [&](auto op) {
+    --sp;
+    stack[sp - 1] = static_cast<double>(op(stack[sp - 1], stack[sp]));
+  };
+
+  for (size_t i = 0; i < m_program.size(); ++i)
+  {
+    const Instruction& instruction = m_program[i];
+    switch (instruction.opcode)
+    {
+    case Opcode::Const:
+      stack[sp++] = instruction.value;
+      break;
+    case Opcode::LoadGPR:
+      stack[sp++] = static_cast<double>(ppc_state.gpr[instruction.operand]);
+      break;
+    case Opcode::LoadFPR:
+      stack[sp++] = ppc_state.ps[instruction.operand].PS0AsDouble();
+      break;
+    case Opcode::LoadSPR:
+      stack[sp++] = static_cast<double>(ppc_state.spr[instruction.operand]);
+      break;
+    case Opcode::LoadPC:
+      stack[sp++] = static_cast<double>(ppc_state.pc);
+      break;
+    case Opcode::LoadMSR:
+      stack[sp++] = static_cast<double>(ppc_state.msr.Hex);
+      break;
+    case Opcode::Negate:
+      stack[sp - 1] = -stack[sp - 1];
+      break;
+    case Opcode::LogicalNot:
+      stack[sp - 1] = !stack[sp - 1];
+      break;
+    case Opcode::BitwiseNot:
+      stack[sp - 1] = static_cast<double>(~to_int(stack[sp - 1]));
+      break;
+    case Opcode::Power:
+      binary([](double a, double b) { return pow(a, b); });
+      break;
+    case Opcode::Multiply:
+      binary([](double a, double b) { return a * b; });
+      break;
+    case Opcode::Divide:
+      binary([](double a, double b) { return a / b; });
+      break;
+    case Opcode::Remainder:
+      binary([](double a, double b) { return fmod(a, b); });
+      break;
+    case Opcode::Add:
+      binary([](double a, double b) { return a + b; });
+      break;
+    case Opcode::Subtract:
+      binary([](double a, double b) { return a - b; });
+      break;
+    case Opcode::ShiftLeft:
+      binary([](double a, double b) { return to_int(a) << to_int(b); });
+      break;
+    case Opcode::ShiftRight:
+      binary([](double a, double b) { return to_int(a) >> to_int(b); });
+      break;
+    case Opcode::Less:
+      binary([](double a, double b) { return a < b; });
+      break;
+    case Opcode::LessEqual:
+      binary([](double a, double b) { return a <= b; });
+      break;
+    case Opcode::Greater:
+      binary([](double a, double b) { return a > b; });
+      break;
+    case Opcode::GreaterEqual:
+      binary([](double a, double b) { return a >= b; });
+      break;
+    case Opcode::Equal:
+      binary([](double a, double b) { return a == b; });
+      break;
+    case Opcode::NotEqual:
+      binary([](double a, double b) { return a != b; });
+      break;
+    case Opcode::BitwiseAnd:
+      binary([](double a, double b) { return to_int(a) & to_int(b); });
+      break;
+    case Opcode::BitwiseOr:
+      binary([](double a, double b) { return to_int(a) | to_int(b); });
+      break;
+    case Opcode::BitwiseXor:
+      binary([](double a, double b) { return to_int(a) ^ to_int(b); });
+      break;
+    case Opcode::SkipIfFalse:
+      if (stack[sp - 1] == 0)
+      {
+        stack[sp - 1] = 0;
+        i = instruction.operand - 1;
+      }
+      else
+      {
+        --sp;
+      }
+      break;
+    case Opcode::SkipIfTrue:
+      if (stack[sp - 1] != 0 && !std::isnan(stack[sp - 1]))
+        i = instruction.operand - 1;
+      else
+        --sp;
+      break;
+    case Opcode::TruthyOrZero:
+      if (stack[sp - 1] == 0)
+        stack[sp - 1] = 0;
+      break;
+    case Opcode::Discard:
+      --sp;
+      break;
+    }
+  }
+
+  return stack[0];
+}
+
+bool Expression::HasNaNVariable(Core::System& system) const
+{
+  // Only floating point registers can hold a NaN.
+  const auto& ppc_state = system.GetPPCState();
+  return std::ranges::any_of(m_binds, [&](const VarBinding& bind) {
+    return bind.type == VarBindingType::FPR && std::isnan(ppc_state.ps[bind.index].PS0AsDouble());
+  });
 }
 
 std::optional<Expression> Expression::TryParse(std::string_view text)
@@ -412,6 +675,25 @@ std::optional<Expression> Expression::TryParse(std::string_view text)
 }
 
 double Expression::Evaluate(Core::System& system) const
+{
+  if (!m_program.empty())
+  {
+    const double result = Run(system);
+
+    // Reporting only has something to do if the condition was met or if a NaN was involved, and
+    // compiled expressions can't change the registers, so skip synchronizing in the common case.
+    if (result == 0.0 && !HasNaNVariable(system))
+      return result;
+
+    SynchronizeBindings(system, SynchronizeDirection::From);
+    Reporting(result);
+    return result;
+  }
+
+  return EvaluateInterpreted(system);
+}
+
+double Expression::EvaluateInterpreted(Core::System& system) const
 {
   SynchronizeBindings(system, SynchronizeDirection::From);
 
@@ -471,15 +753,18 @@ void Expression::SynchronizeBindings(Core::System& system, SynchronizeDirection
 void Expression::Reporting(const double result) const
 {
   bool is_nan = std::isnan(result);
-  std::string message;
-
   for (auto* v = m_vars->head; v != nullptr; v = v->next)
   {
     if (std::isnan(v->value))
       is_nan = true;
+  }
 
+  if (result == 0.0 && !is_nan)
+    return;
+
+  std::string message;
+  for (auto* v = m_vars->head; v != nullptr; v = v->next)
     fmt::format_to(std::back_inserter(message), "  {}={}", v->name, v->value);
-  }
 
   if (is_nan)
   {
@@ -487,8 +772,7 @@ void Expression::Reporting(const double result) const
     Core::DisplayMessage("Breakpoint condition has encountered a NaN.", 2000);
   }
 
-  if (result != 0.0 || is_nan)
-    NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
+  NOTICE_LOG_FMT(MEMMAP, "Breakpoint condition returned: {}. Vars:{}", result, message);
 }
 
 std::string Expression::GetText() const
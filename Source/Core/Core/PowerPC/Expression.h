@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -39,6 +40,11 @@ public:
 
   double Evaluate(Core::System& system) const;
 
+  // Whether Evaluate runs the compiled program rather than the interpreter.
+  bool IsCompiled() const { return !m_program.empty(); }
+  // Always uses the interpreter, which compiled programs must match exactly.
+  double EvaluateInterpreted(Core::System& system) const;
+
   std::string GetText() const;
 
 private:
@@ -64,8 +70,57 @@ private:
     int index = -1;
   };
 
+  enum class Opcode
+  {
+    Const,
+    LoadGPR,
+    LoadFPR,
+    LoadSPR,
+    LoadPC,
+    LoadMSR,
+    Negate,
+    LogicalNot,
+    BitwiseNot,
+    Power,
+    Multiply,
+    Divide,
+    Remainder,
+    Add,
+    Subtract,
+    ShiftLeft,
+    ShiftRight,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    BitwiseAnd,
+    BitwiseOr,
+    BitwiseXor,
+    // Short-circuit the logical operators by jumping to the instruction at operand.
+    SkipIfFalse,
+    SkipIfTrue,
+    // Turns the result of a logical operator into 0 unless it is truthy.
+    TruthyOrZero,
+    Discard,
+  };
+
+  struct Instruction
+  {
+    Opcode opcode;
+    int operand = 0;
+    double value = 0;
+  };
+
+  static constexpr size_t MAX_STACK_DEPTH = 32;
+
   Expression(std::string_view text, ExprPointer ex, ExprVarListPointer vars);
 
+  bool Compile(const expr& node, size_t depth);
+  double Run(Core::System& system) const;
+  bool HasNaNVariable(Core::System& system) const;
+
   void SynchronizeBindings(Core::System& system, SynchronizeDirection dir) const;
   void Reporting(const double result) const;
 
@@ -73,6 +128,12 @@ private:
   ExprPointer m_expr;
   ExprVarListPointer m_vars;
   std::vector<VarBinding> m_binds;
+
+  // The expression flattened into instructions for a small stack machine that reads registers
+  // directly. This is a lot cheaper than walking the expression tree and copying every variable
+  // in and out of the interpreter. Empty if the expression uses something that the stack machine
+  // doesn't support (function calls and assignments), in which case the interpreter is used.
+  std::vector<Instruction> m_program;
 };
 
 inline bool EvaluateCondition(Core::System& system, const std::optional<Expression>& condition)
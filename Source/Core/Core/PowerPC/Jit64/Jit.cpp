@@ -151,6 +151,16 @@ bool Jit64::HandleFault(uintptr_t access_address, SContext* ctx)
                    "PC {:#018x}, access address {:#018x}, memory base {:#018x}, MSR.DR {}",
                    ctx->CTX_PC, access_address, memory_base, ppc_state.msr.DR);
     }
+    else if (ppc_state.msr.DR)
+    {
+      // Page table translated pages are only mapped into the logical view on first access.
+      const auto it = m_back_patch_info.find(reinterpret_cast<u8*>(ctx->CTX_PC));
+      if (it != m_back_patch_info.end() &&
+          m_mmu.MapPageForFastmem(static_cast<u32>(access_address - memory_base), !it->second.read))
+      {
+        return true;
+      }
+    }
 
     return BackPatch(ctx);
   }
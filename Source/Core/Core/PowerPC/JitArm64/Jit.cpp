@@ -142,7 +142,7 @@ bool JitArm64::HandleFault(uintptr_t access_address, SContext* ctx)
       }
       else
       {
-        success = HandleFastmemFault(ctx);
+        success = HandleFastmemFault(ctx, static_cast<u32>(access_address - memory_base));
       }
     }
   }
@@ -37,7 +37,7 @@ public:
   bool IsInCodeSpace(const u8* ptr) const { return IsInSpace(ptr); }
   bool HandleFault(uintptr_t access_address, SContext* ctx) override;
   void DoBacktrace(uintptr_t access_address, SContext* ctx);
-  bool HandleFastmemFault(SContext* ctx);
+  bool HandleFastmemFault(SContext* ctx, u32 guest_address);
 
   void ClearCache() override;
 
@@ -114,9 +114,7 @@ public:
   void mcrf(UGeckoInstruction inst);
   void mcrxr(UGeckoInstruction inst);
   void mfsr(UGeckoInstruction inst);
-  void mtsr(UGeckoInstruction inst);
   void mfsrin(UGeckoInstruction inst);
-  void mtsrin(UGeckoInstruction inst);
   void twx(UGeckoInstruction inst);
   void mfspr(UGeckoInstruction inst);
   void mftb(UGeckoInstruction inst);
@@ -190,6 +188,7 @@ protected:
   {
     const u8* fast_access_code;
     const u8* slow_access_code;
+    bool is_store;
   };
 
   void SetBlockLinkingEnabled(bool enabled);
@@ -163,6 +163,7 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
         FastmemArea* fastmem_area = &m_fault_to_handler[fast_access_end];
         fastmem_area->fast_access_code = fast_access_start;
         fastmem_area->slow_access_code = GetCodePtr();
+        fastmem_area->is_store = (flags & BackPatchInfo::FLAG_LOAD) == 0;
       }
     }
 
@@ -316,7 +317,7 @@ void JitArm64::EmitBackpatchRoutine(u32 flags, MemAccessMode mode, ARM64Reg RS,
   }
 }
 
-bool JitArm64::HandleFastmemFault(SContext* ctx)
+bool JitArm64::HandleFastmemFault(SContext* ctx, u32 guest_address)
 {
   const u8* pc = reinterpret_cast<const u8*>(ctx->CTX_PC);
   auto slow_handler_iter = m_fault_to_handler.upper_bound(pc);
@@ -332,6 +333,13 @@ bool JitArm64::HandleFastmemFault(SContext* ctx)
   if (pc < fastmem_area_start)
     return false;
 
+  // Page table translated pages are only mapped into the logical view on first access.
+  if (m_ppc_state.msr.DR &&
+      m_mmu.MapPageForFastmem(guest_address, slow_handler_iter->second.is_store))
+  {
+    return true;
+  }
+
   const Common::ScopedJITPageWriteAndNoExecute enable_jit_page_writes;
   ARM64XEmitter emitter(const_cast<u8*>(fastmem_area_start), const_cast<u8*>(fastmem_area_end));
 
@@ -12,6 +12,7 @@
 #include "Common/Assert.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "Core/Core.h"
@@ -180,6 +181,11 @@ void JitInterface::JitBlockLogDump(const Core::CPUThreadGuard& guard, std::FILE*
                    host_far_code_size, symbol ? std::string_view{symbol->name} : "");
     });
   }
+
+  const PowerPC::MMU::TLBStats& tlb_stats = m_system.GetMMU().GetTLBStats();
+  const u64 tlb_lookups = tlb_stats.hits + tlb_stats.misses;
+  NOTICE_LOG_FMT(DYNA_REC, "TLB: {} hits, {} misses ({:.2f}% hit rate)", tlb_stats.hits,
+                 tlb_stats.misses, tlb_lookups == 0 ? 0.0 : 100.0 * tlb_stats.hits / tlb_lookups);
 }
 
 std::variant<JitInterface::GetHostCodeError, JitInterface::GetHostCodeResult>
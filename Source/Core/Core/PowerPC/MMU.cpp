@@ -920,7 +920,9 @@ std::optional<ReadResult<std::string>> MMU::HostTryReadString(const Core::CPUThr
 
 bool MMU::IsOptimizableRAMAddress(const u32 address, const u32 access_size) const
 {
-  if (m_power_pc.GetMemChecks().HasAny())
+  const u32 last_byte_address = address + (access_size >> 3) - 1;
+  const MemChecks& mem_checks = m_power_pc.GetMemChecks();
+  if (mem_checks.IsPageWatched(address) || mem_checks.IsPageWatched(last_byte_address))
     return false;
 
   if (!m_ppc_state.msr.DR)
@@ -931,7 +933,6 @@ bool MMU::IsOptimizableRAMAddress(const u32 address, const u32 access_size) cons
 
   // We store whether an access can be optimized to an unchecked access
   // in dbat_table.
-  const u32 last_byte_address = address + (access_size >> 3) - 1;
   const u32 bat_result_1 = m_dbat_table[address >> BAT_INDEX_SHIFT];
   const u32 bat_result_2 = m_dbat_table[last_byte_address >> BAT_INDEX_SHIFT];
   return (bat_result_1 & bat_result_2 & BAT_PHYSICAL_BIT) != 0;
@@ -1014,6 +1015,53 @@ bool MMU::HostIsInstructionRAMAddress(const Core::CPUThreadGuard& guard, u32 add
   return false;
 }
 
+const u8* MMU::HostGetRAMPagePointer(const Core::CPUThreadGuard& guard, u32 address,
+                                     RequestedAddressSpace space)
+{
+  auto& mmu = guard.GetSystem().GetMMU();
+  if (mmu.m_ppc_state.m_enable_dcache)
+    return nullptr;
+
+  bool translate = false;
+  switch (space)
+  {
+  case RequestedAddressSpace::Effective:
+    translate = mmu.m_ppc_state.msr.DR;
+    break;
+  case RequestedAddressSpace::Physical:
+    translate = false;
+    break;
+  case RequestedAddressSpace::Virtual:
+    if (!mmu.m_ppc_state.msr.DR)
+      return nullptr;
+    translate = true;
+    break;
+  }
+
+  // Translation always works on whole pages, so the rest of the page maps to the same place.
+  address &= ~static_cast<u32>(HW_PAGE_MASK);
+  if (translate)
+  {
+    const auto translated_address = mmu.TranslateAddress<XCheckTLBFlag::NoException>(address);
+    if (!translated_address.Success())
+      return nullptr;
+    address = translated_address.address;
+  }
+
+  // This must resolve addresses the same way as ReadFromHardware.
+  Memory::MemoryManager& memory = mmu.m_memory;
+  const u32 segment = address >> 28;
+  if (memory.GetL1Cache() && segment == 0xE && address < 0xE0000000 + memory.GetL1CacheSize())
+    return &memory.GetL1Cache()[address & 0x0FFFFFFF];
+  if (memory.GetRAM() && segment == 0x0 && address < memory.GetRamSizeReal())
+    return &memory.GetRAM()[address];
+  if (memory.GetEXRAM() && segment == 0x1 && (address & 0x0FFFFFFF) < memory.GetExRamSizeReal())
+    return &memory.GetEXRAM()[address & 0x0FFFFFFF];
+  if (memory.GetFakeVMEM() && (address & 0xFE000000) == 0x7E000000)
+    return &memory.GetFakeVMEM()[address & memory.GetFakeVMemMask()];
+  return nullptr;
+}
+
 void MMU::DMA_LCToMemory(const u32 mem_address, const u32 cache_address, const u32 num_blocks)
 {
   // TODO: It's not completely clear this is the right spot for this code;
@@ -1212,7 +1260,7 @@ void MMU::TouchDCacheLine(u32 address, bool store)
 
 u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
 {
-  if (m_power_pc.GetMemChecks().HasAny())
+  if (m_power_pc.GetMemChecks().IsPageWatched(address))
     return 0;
 
   if (!m_ppc_state.msr.DR)
@@ -1238,7 +1286,7 @@ u32 MMU::IsOptimizableMMIOAccess(u32 address, u32 access_size) const
 
 bool MMU::IsOptimizableGatherPipeWrite(u32 address) const
 {
-  if (m_power_pc.GetMemChecks().HasAny())
+  if (m_power_pc.GetMemChecks().IsPageWatched(address))
     return false;
 
   if (!m_ppc_state.msr.DR)
@@ -1324,6 +1372,8 @@ void MMU::SDRUpdated()
 
   m_ppc_state.pagetable_base = htaborg << 16;
   m_ppc_state.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+
+  m_memory.UnmapPageTableTranslations();
 }
 
 enum class TLBLookupResult
@@ -1333,6 +1383,8 @@ enum class TLBLookupResult
   UpdateC
 };
 
+static_assert(PowerPC::TLB_SETS == HW_PAGE_INDEX_MASK + 1);
+
 static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
                                             const XCheckTLBFlag flag, const u32 vpa, const u32 vsid,
                                             u32* paddr, bool* wi)
@@ -1341,32 +1393,12 @@ static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
   const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
   TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
 
-  if (tlbe.tag[0] == tag && tlbe.vsid[0] == vsid)
+  for (u32 way = 0; way < PowerPC::TLB_WAYS; ++way)
   {
-    UPTE_Hi pte2(tlbe.pte[0]);
-
-    // Check if C bit requires updating
-    if (flag == XCheckTLBFlag::Write)
-    {
-      if (pte2.C == 0)
-      {
-        pte2.C = 1;
-        tlbe.pte[0] = pte2.Hex;
-        return TLBLookupResult::UpdateC;
-      }
-    }
-
-    if (!IsNoExceptionFlag(flag))
-      tlbe.recent = 0;
-
-    *paddr = tlbe.paddr[0] | (vpa & 0xfff);
-    *wi = (pte2.WIMG & 0b1100) != 0;
+    if (tlbe.tag[way] != tag || tlbe.vsid[way] != vsid)
+      continue;
 
-    return TLBLookupResult::Found;
-  }
-  if (tlbe.tag[1] == tag && tlbe.vsid[1] == vsid)
-  {
-    UPTE_Hi pte2(tlbe.pte[1]);
+    UPTE_Hi pte2(tlbe.pte[way]);
 
     // Check if C bit requires updating
     if (flag == XCheckTLBFlag::Write)
@@ -1374,15 +1406,15 @@ static TLBLookupResult LookupTLBPageAddress(PowerPC::PowerPCState& ppc_state,
       if (pte2.C == 0)
       {
         pte2.C = 1;
-        tlbe.pte[1] = pte2.Hex;
+        tlbe.pte[way] = pte2.Hex;
         return TLBLookupResult::UpdateC;
       }
     }
 
     if (!IsNoExceptionFlag(flag))
-      tlbe.recent = 1;
+      tlbe.MarkUsed(way);
 
-    *paddr = tlbe.paddr[1] | (vpa & 0xfff);
+    *paddr = tlbe.paddr[way] | (vpa & 0xfff);
     *wi = (pte2.WIMG & 0b1100) != 0;
 
     return TLBLookupResult::Found;
@@ -1399,20 +1431,36 @@ static void UpdateTLBEntry(PowerPC::PowerPCState& ppc_state, const XCheckTLBFlag
   const u32 tag = address >> HW_PAGE_INDEX_SHIFT;
   const size_t tlb_index = IsOpcodeFlag(flag) ? PowerPC::INST_TLB_INDEX : PowerPC::DATA_TLB_INDEX;
   TLBEntry& tlbe = ppc_state.tlb[tlb_index][tag & HW_PAGE_INDEX_MASK];
-  const u32 index = tlbe.recent == 0 && tlbe.tag[0] != TLBEntry::INVALID_TAG;
-  tlbe.recent = index;
+  const u32 index = tlbe.GetReplacementWay();
+  tlbe.MarkUsed(index);
   tlbe.paddr[index] = pte2.RPN << HW_PAGE_INDEX_SHIFT;
   tlbe.pte[index] = pte2.Hex;
   tlbe.tag[index] = tag;
   tlbe.vsid[index] = vsid;
 }
 
+static bool IsTLBEntryChanged(const PowerPC::PowerPCState& ppc_state, const u32 vpa,
+                              const u32 vsid)
+{
+  const u32 tag = vpa >> HW_PAGE_INDEX_SHIFT;
+  const TLBEntry& tlbe = ppc_state.tlb[PowerPC::DATA_TLB_INDEX][tag & HW_PAGE_INDEX_MASK];
+
+  for (u32 way = 0; way < PowerPC::TLB_WAYS; ++way)
+  {
+    if (tlbe.tag[way] == tag && tlbe.vsid[way] == vsid)
+      return UPTE_Hi(tlbe.pte[way]).C != 0;
+  }
+  return false;
+}
+
 void MMU::InvalidateTLBEntry(u32 address)
 {
   const u32 entry_index = (address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK;
 
   m_ppc_state.tlb[PowerPC::DATA_TLB_INDEX][entry_index].Invalidate();
   m_ppc_state.tlb[PowerPC::INST_TLB_INDEX][entry_index].Invalidate();
+
+  m_memory.UnmapPageTableTranslations(entry_index);
 }
 
 // Page Address Translation
@@ -1428,6 +1476,13 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
   u32 translated_address = 0;
   const TLBLookupResult res =
       LookupTLBPageAddress(m_ppc_state, flag, address.Hex, VSID, &translated_address, wi);
+  if (!IsNoExceptionFlag(flag))
+  {
+    if (res == TLBLookupResult::NotFound)
+      ++m_tlb_stats.misses;
+    else
+      ++m_tlb_stats.hits;
+  }
   if (res == TLBLookupResult::Found)
   {
     return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
@@ -1515,6 +1570,59 @@ MMU::TranslateAddressResult MMU::TranslatePageAddress(const EffectiveAddress add
   return TranslateAddressResult{TranslateAddressResultEnum::PAGE_FAULT, 0};
 }
 
+bool MMU::IsFastmemMappable(u32 physical_address) const
+{
+  if (m_memory.GetFakeVMEM() && (physical_address & 0xFE000000) == 0x7E000000)
+    return true;
+  if (physical_address < m_memory.GetRamSizeReal())
+    return true;
+  if (m_memory.GetEXRAM() && physical_address >> 28 == 0x1 &&
+      (physical_address & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
+  {
+    return true;
+  }
+  return physical_address >> 28 == 0xE &&
+         physical_address < 0xE0000000 + m_memory.GetL1CacheSize();
+}
+
+bool MMU::MapPageForFastmem(u32 effective_address, bool write)
+{
+  // Fast accesses don't support memchecks.
+  const u32 page_address = effective_address & ~static_cast<u32>(HW_PAGE_MASK);
+  if (m_power_pc.GetMemChecks().OverlapsMemcheck(page_address, HW_PAGE_SIZE))
+    return false;
+
+  // BAT translated addresses that fault are ones that UpdateBATs deliberately didn't map.
+  bool wi = false;
+  u32 bat_address = effective_address;
+  if (TranslateBatAddress(m_dbat_table, &bat_address, &wi))
+    return false;
+
+  // Do the same translation the slow access would do, including setting the R and C bits.
+  const EffectiveAddress address{effective_address};
+  const TranslateAddressResult result =
+      write ? TranslatePageAddress<XCheckTLBFlag::Write>(address, &wi) :
+              TranslatePageAddress<XCheckTLBFlag::Read>(address, &wi);
+  if (result.result != TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED || wi ||
+      !IsFastmemMappable(result.address))
+  {
+    return false;
+  }
+
+  // Once the page is mapped, stores to it won't go through TranslatePageAddress anymore, so only
+  // map pages whose C bit is already set.
+  const u32 vsid = UReg_SR{m_ppc_state.sr[address.SR]}.VSID;
+  if (!write && !IsTLBEntryChanged(m_ppc_state, effective_address, vsid))
+    return false;
+
+  return m_memory.MapPageTableTranslation(page_address, result.address);
+}
+
+void MMU::SRUpdated()
+{
+  m_memory.UnmapPageTableTranslations();
+}
+
 void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
 {
   // TODO: Separate BATs for MSR.PR==0 and MSR.PR==1
@@ -1574,27 +1682,8 @@ void MMU::UpdateBATs(BatTable& bat_table, u32 base_spr)
         // Enable fastmem mappings for cached memory. There are quirks related to uncached memory
         // that can't be correctly emulated by fast accesses, so we don't map uncached memory.
         // (No normal games are known to rely on the quirks, though.)
-        if (!wi)
-        {
-          if (m_memory.GetFakeVMEM() && (physical_address & 0xFE000000) == 0x7E000000)
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-          else if (physical_address < m_memory.GetRamSizeReal())
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-          else if (m_memory.GetEXRAM() && physical_address >> 28 == 0x1 &&
-                   (physical_address & 0x0FFFFFFF) < m_memory.GetExRamSizeReal())
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-          else if (physical_address >> 28 == 0xE &&
-                   physical_address < 0xE0000000 + m_memory.GetL1CacheSize())
-          {
-            valid_bit |= BAT_PHYSICAL_BIT;
-          }
-        }
+        if (!wi && IsFastmemMappable(physical_address))
+          valid_bit |= BAT_PHYSICAL_BIT;
 
         // Fast accesses don't support memchecks, so force slow accesses by removing fastmem
         // mappings for all overlapping virtual pages.
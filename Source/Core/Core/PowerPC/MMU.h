@@ -207,6 +207,14 @@ public:
   HostIsInstructionRAMAddress(const Core::CPUThreadGuard& guard, u32 address,
                               RequestedAddressSpace space = RequestedAddressSpace::Effective);
 
+  // Returns a pointer to the host memory backing the HW page that contains the given address, or
+  // nullptr if that page isn't RAM in the given address space or can't be read directly (because
+  // the data cache is being emulated). Meant for host code that scans large amounts of memory and
+  // would rather not translate every single address. Only valid while the guard is held.
+  static const u8*
+  HostGetRAMPagePointer(const Core::CPUThreadGuard& guard, u32 address,
+                        RequestedAddressSpace space = RequestedAddressSpace::Effective);
+
   // Routines for the CPU core to access memory.
 
   // Used by interpreter to read instructions, uses iCache
@@ -238,7 +246,13 @@ public:
 
   // TLB functions
   void SDRUpdated();
+  void SRUpdated();
   void InvalidateTLBEntry(u32 address);
+
+  // Called by the JITs when a fastmem access with MSR.DR set faults. If the page table maps the
+  // page to RAM, maps it into the logical fastmem view so the access can simply be retried
+  // instead of being backpatched into a slow access.
+  bool MapPageForFastmem(u32 effective_address, bool write);
   void DBATUpdated();
   void IBATUpdated();
 
@@ -256,6 +270,16 @@ public:
   BatTable& GetIBATTable() { return m_ibat_table; }
   BatTable& GetDBATTable() { return m_dbat_table; }
 
+  // Counts page address translations done on behalf of the emulated CPU (debugger accesses are
+  // not included). A miss means that the page table had to be walked.
+  struct TLBStats
+  {
+    u64 hits = 0;
+    u64 misses = 0;
+  };
+  const TLBStats& GetTLBStats() const { return m_tlb_stats; }
+  void ResetTLBStats() { m_tlb_stats = {}; }
+
 private:
   enum class TranslateAddressResultEnum : u8
   {
@@ -302,6 +326,7 @@ private:
 
   void Memcheck(u32 address, u64 var, bool write, size_t size);
 
+  bool IsFastmemMappable(u32 physical_address) const;
   void UpdateBATs(BatTable& bat_table, u32 base_spr);
   void UpdateFakeMMUBat(BatTable& bat_table, u32 start_addr);
 
@@ -326,6 +351,8 @@ private:
 
   BatTable m_ibat_table;
   BatTable m_dbat_table;
+
+  TLBStats m_tlb_stats;
 };
 
 void ClearDCacheLineFromJit(MMU& mmu, u32 address);
@@ -21,6 +21,7 @@
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
 #include "Core/HW/CPU.h"
+#include "Core/HW/Memmap.h"
 #include "Core/HW/SystemTimers.h"
 #include "Core/Host.h"
 #include "Core/PowerPC/CPUCoreBase.h"
@@ -277,6 +278,8 @@ void PowerPCManager::Reset()
   m_ppc_state.pagetable_base = 0;
   m_ppc_state.pagetable_hashmask = 0;
   m_ppc_state.tlb = {};
+  m_system.GetMMU().ResetTLBStats();
+  m_system.GetMemory().UnmapPageTableTranslations();
 
   ResetRegisters();
   m_ppc_state.iCache.Reset(m_system.GetJitInterface());
@@ -47,25 +47,61 @@ enum class CoreMode
 };
 
 // TLB cache
-constexpr size_t TLB_SIZE = 128;
+// The set count matches the hardware, since tlbie invalidates a whole set. The associativity is
+// higher than the hardware's two ways so that MMU-heavy games take fewer page table walks.
+constexpr size_t TLB_SETS = 64;
+constexpr size_t TLB_WAYS = 4;
+constexpr size_t TLB_SIZE = TLB_SETS * TLB_WAYS;
 constexpr size_t NUM_TLBS = 2;
-constexpr size_t TLB_WAYS = 2;
 constexpr size_t DATA_TLB_INDEX = 0;
 constexpr size_t INST_TLB_INDEX = 1;
 
+static_assert(TLB_WAYS >= 2 && TLB_WAYS <= 32);
+
 struct TLBEntry
 {
   using WayArray = std::array<u32, TLB_WAYS>;
 
   static constexpr u32 INVALID_TAG = 0xffffffff;
 
-  WayArray tag{INVALID_TAG, INVALID_TAG};
+  static constexpr WayArray InvalidTags()
+  {
+    WayArray tags{};
+    tags.fill(INVALID_TAG);
+    return tags;
+  }
+
+  WayArray tag = InvalidTags();
   WayArray paddr{};
   WayArray vsid{};
   WayArray pte{};
+  // Bit N is set if way N has been used since the last time all ways were. This is exact LRU for
+  // two ways and a cheap approximation of it for more.
   u32 recent = 0;
 
   void Invalidate() { tag.fill(INVALID_TAG); }
+
+  void MarkUsed(u32 way)
+  {
+    constexpr u32 all_ways = static_cast<u32>((u64{1} << TLB_WAYS) - 1);
+    const u32 way_bit = 1u << way;
+    recent = (recent | way_bit) == all_ways ? way_bit : (recent | way_bit);
+  }
+
+  u32 GetReplacementWay() const
+  {
+    for (u32 way = 0; way < TLB_WAYS; ++way)
+    {
+      if (tag[way] == INVALID_TAG)
+        return way;
+    }
+    for (u32 way = 0; way < TLB_WAYS; ++way)
+    {
+      if ((recent & (1u << way)) == 0)
+        return way;
+    }
+    return 0;
+  }
 };
 
 struct PairedSingle
@@ -175,7 +211,7 @@ struct PowerPCState
   u8* stored_stack_pointer = nullptr;
   u8* mem_ptr = nullptr;
 
-  std::array<std::array<TLBEntry, TLB_SIZE / TLB_WAYS>, NUM_TLBS> tlb;
+  std::array<std::array<TLBEntry, TLB_SETS>, NUM_TLBS> tlb;
 
   u32 pagetable_base = 0;
   u32 pagetable_hashmask = 0;
@@ -98,7 +98,7 @@ static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
 // Don't forget to increase this after doing changes on the savestate system
-constexpr u32 STATE_VERSION = 168;  // Last changed in PR 12639
+constexpr u32 STATE_VERSION = 171;  // Last changed when MixerFifo started saving its history
 
 // Increase this if the StateExtendedHeader definition changes
 constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
@@ -532,6 +532,48 @@ void SaveAs(Core::System& system, const std::string& filename, bool wait)
       true);
 }
 
+bool SaveMovieKeyframe(Core::System& system, const std::string& filename)
+{
+  std::unique_lock lk(s_load_or_save_in_progress_mutex, std::try_to_lock);
+  if (!lk)
+    return false;
+
+  bool success = false;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        u8* ptr = nullptr;
+        PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+        DoState(system, p_measure);
+        const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+
+        std::vector<u8> buffer(buffer_size);
+        ptr = buffer.data();
+        PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+        DoState(system, p);
+        if (!p.IsWriteMode())
+          return;
+
+        // Written synchronously so that the caller only indexes keyframes that made it to disk.
+        const std::string temp_filename = filename + ".tmp";
+        File::IOFile f(temp_filename, "wb");
+        if (!f)
+          return;
+
+        WriteHeadersToFile(buffer_size, f);
+        if (s_use_compression)
+          CompressBufferToFile(buffer.data(), buffer_size, f);
+        else
+          f.WriteBytes(buffer.data(), buffer_size);
+
+        success = f.IsGood() && f.Close() && File::Rename(temp_filename, filename);
+        if (!success)
+          File::Delete(temp_filename);
+      },
+      true);
+  return success;
+}
+
 static bool GetVersionFromLZO(StateHeader& header, File::IOFile& f)
 {
   // Just read the first block, since it will contain the full revision string
@@ -935,6 +977,43 @@ void LoadAs(Core::System& system, const std::string& filename)
       true);
 }
 
+bool LoadMovieKeyframe(Core::System& system, const std::string& filename)
+{
+  if (!Core::IsRunningOrStarting(system) || NetPlay::IsNetPlayRunning() ||
+      AchievementManager::GetInstance().IsHardcoreModeActive())
+  {
+    return false;
+  }
+
+  std::unique_lock lk(s_load_or_save_in_progress_mutex, std::try_to_lock);
+  if (!lk)
+    return false;
+
+  bool success = false;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        std::vector<u8> buffer;
+        LoadFileStateData(filename, buffer);
+        if (buffer.empty())
+          return;
+
+        // Unlike LoadAs, this doesn't go through the undo state, which would also need a copy of
+        // the movie; a failed load is rolled back right away instead.
+        std::vector<u8> backup;
+        SaveToBuffer(system, backup);
+
+        u8* ptr = buffer.data();
+        PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+        DoState(system, p);
+        success = p.IsReadMode();
+        if (!success)
+          LoadFromBuffer(system, backup);
+      },
+      true);
+  return success;
+}
+
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 {
   s_on_after_load_callback = std::move(callback);
@@ -106,6 +106,12 @@ void Load(Core::System& system, int slot);
 void SaveAs(Core::System& system, const std::string& filename, bool wait = false);
 void LoadAs(Core::System& system, const std::string& filename);
 
+// Savestates used by the movie player to seek. They are only valid alongside the movie they were
+// taken from, so unlike SaveAs/LoadAs these don't store a copy of the movie, don't touch the undo
+// states and don't show messages. Both block until done and return whether they succeeded.
+bool SaveMovieKeyframe(Core::System& system, const std::string& filename);
+bool LoadMovieKeyframe(Core::System& system, const std::string& filename);
+
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer);
 
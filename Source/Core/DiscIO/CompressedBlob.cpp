@@ -6,8 +6,10 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstring>
+#include <future>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -32,6 +34,15 @@
 
 namespace DiscIO
 {
+// How much decompressed data each SectorReader cache line should hold. Reading several blocks at
+// once lets ReadMultipleAlignedBlocks fetch them with one file read and decompress them in
+// parallel, which is what makes sequential reads (booting, streamed audio and video) cheap.
+static constexpr u64 GCZ_CACHE_CHUNK_TARGET_SIZE = 0x40000;
+static constexpr u64 GCZ_MAX_CACHE_CHUNK_BLOCKS = 64;
+
+// Splitting a run across threads isn't worth it unless each thread gets at least this many blocks.
+static constexpr u64 GCZ_MIN_BLOCKS_PER_THREAD = 2;
+
 bool IsGCZBlob(File::IOFile& file);
 
 CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string& filename)
@@ -42,6 +53,11 @@ CompressedBlobReader::CompressedBlobReader(File::IOFile file, const std::string&
   m_file.ReadArray(&m_header, 1);
 
   SetSectorSize(m_header.block_size);
+  if (m_header.block_size != 0)
+  {
+    SetChunkSize(static_cast<int>(std::clamp<u64>(
+        GCZ_CACHE_CHUNK_TARGET_SIZE / m_header.block_size, 1, GCZ_MAX_CACHE_CHUNK_BLOCKS)));
+  }
 
   // cache block pointers and hashes
   m_block_pointers.resize(m_header.num_blocks);
@@ -92,24 +108,83 @@ u64 CompressedBlobReader::GetBlockCompressedSize(u64 block_num) const
   return 0;
 }
 
-bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
+u64 CompressedBlobReader::GetBlockFileOffset(u64 block_num) const
 {
-  bool uncompressed = false;
-  u32 comp_block_size = (u32)GetBlockCompressedSize(block_num);
-  u64 offset = m_block_pointers[block_num] + m_data_offset;
+  return (m_block_pointers[block_num] & ~(1ULL << 63)) + m_data_offset;
+}
+
+bool CompressedBlobReader::IsBlockCompressed(u64 block_num) const
+{
+  return (m_block_pointers[block_num] & (1ULL << 63)) == 0;
+}
 
-  if (offset & (1ULL << 63))
+bool CompressedBlobReader::DecompressBlock(u64 block_num, const u8* in, u32 comp_block_size,
+                                           u8* out_ptr) const
+{
+  // First, check hash.
+  const u32 block_hash = Common::HashAdler32(in, comp_block_size);
+  if (block_hash != m_hashes[block_num])
+  {
+    ERROR_LOG_FMT(DISCIO,
+                  "The disc image \"{}\" is corrupt.\n"
+                  "Hash of block {} is {:08x} instead of {:08x}.",
+                  m_file_name, block_num, block_hash, m_hashes[block_num]);
+  }
+
+  if (!IsBlockCompressed(block_num))
   {
     if (comp_block_size != m_header.block_size)
       ERROR_LOG_FMT(DISCIO, "Uncompressed block with wrong size");
-    uncompressed = true;
-    offset &= ~(1ULL << 63);
+    std::copy(in, in + std::min(comp_block_size, m_header.block_size), out_ptr);
+    return true;
+  }
+
+  if (comp_block_size > m_header.block_size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Compressed block size is larger than uncompressed block size");
   }
 
-  // clear unused part of zlib buffer. maybe this can be deleted when it works fully.
-  memset(&m_zlib_buffer[comp_block_size], 0, m_zlib_buffer.size() - comp_block_size);
+  // Every block is an independent zlib stream and the output buffer always has room for a whole
+  // block, so decode it with a single Z_FINISH call. This lets zlib skip allocating and
+  // maintaining its sliding window.
+  z_stream z = {};
+  z.next_in = const_cast<u8*>(in);
+  z.avail_in = comp_block_size;
+  z.next_out = out_ptr;
+  z.avail_out = m_header.block_size;
+  if (inflateInit(&z) != Z_OK)
+  {
+    ERROR_LOG_FMT(DISCIO, "Failed to initialize zlib for block {}", block_num);
+    return false;
+  }
+  const int status = inflate(&z, Z_FINISH);
+  const u32 uncomp_size = m_header.block_size - z.avail_out;
+  inflateEnd(&z);
+  if (status != Z_STREAM_END)
+  {
+    // this seem to fire wrongly from time to time
+    // to be sure, don't use compressed isos :P
+    ERROR_LOG_FMT(DISCIO, "Failure reading block {} - out of data and not at end.", block_num);
+  }
+  if (uncomp_size != m_header.block_size)
+  {
+    ERROR_LOG_FMT(DISCIO, "Wrong block size");
+    return false;
+  }
+  return true;
+}
 
-  m_file.Seek(offset, File::SeekOrigin::Begin);
+bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
+{
+  const u32 comp_block_size = static_cast<u32>(GetBlockCompressedSize(block_num));
+  if (comp_block_size > m_zlib_buffer.size())
+  {
+    ERROR_LOG_FMT(DISCIO, "Block {} of \"{}\" has an invalid size of {} bytes", block_num,
+                  m_file_name, comp_block_size);
+    return false;
+  }
+
+  m_file.Seek(GetBlockFileOffset(block_num), File::SeekOrigin::Begin);
   if (!m_file.ReadBytes(m_zlib_buffer.data(), comp_block_size))
   {
     ERROR_LOG_FMT(DISCIO, "The disc image \"{}\" is truncated, some of the data is missing.",
@@ -118,48 +193,69 @@ bool CompressedBlobReader::GetBlock(u64 block_num, u8* out_ptr)
     return false;
   }
 
-  // First, check hash.
-  const u32 block_hash = Common::HashAdler32(m_zlib_buffer.data(), comp_block_size);
-  if (block_hash != m_hashes[block_num])
+  return DecompressBlock(block_num, m_zlib_buffer.data(), comp_block_size, out_ptr);
+}
+
+bool CompressedBlobReader::ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr)
+{
+  if (num_blocks <= 1 || block_num + num_blocks > m_header.num_blocks)
+    return SectorReader::ReadMultipleAlignedBlocks(block_num, num_blocks, out_ptr);
+
+  // ConvertToGCZ writes blocks in order, so the compressed data for a run of blocks is normally
+  // contiguous in the file and can be fetched with a single read. If that isn't the case for some
+  // reason, fall back to reading the blocks one by one.
+  const u64 first_offset = GetBlockFileOffset(block_num);
+  u64 run_size = 0;
+  for (u64 i = block_num; i < block_num + num_blocks; ++i)
   {
-    ERROR_LOG_FMT(DISCIO,
-                  "The disc image \"{}\" is corrupt.\n"
-                  "Hash of block {} is {:08x} instead of {:08x}.",
-                  m_file_name, block_num, block_hash, m_hashes[block_num]);
+    const u32 comp_block_size = static_cast<u32>(GetBlockCompressedSize(i));
+    if (GetBlockFileOffset(i) != first_offset + run_size || comp_block_size > m_header.block_size)
+      return SectorReader::ReadMultipleAlignedBlocks(block_num, num_blocks, out_ptr);
+    run_size += comp_block_size;
   }
 
-  if (uncompressed)
+  m_run_buffer.resize(run_size);
+  m_file.Seek(first_offset, File::SeekOrigin::Begin);
+  if (!m_file.ReadBytes(m_run_buffer.data(), run_size))
   {
-    std::copy(m_zlib_buffer.begin(), m_zlib_buffer.begin() + comp_block_size, out_ptr);
+    ERROR_LOG_FMT(DISCIO, "The disc image \"{}\" is truncated, some of the data is missing.",
+                  m_file_name);
+    m_file.ClearError();
+    return false;
   }
-  else
-  {
-    z_stream z = {};
-    z.next_in = m_zlib_buffer.data();
-    z.avail_in = comp_block_size;
-    if (z.avail_in > m_header.block_size)
-    {
-      ERROR_LOG_FMT(DISCIO, "Compressed block size is larger than uncompressed block size");
-    }
-    z.next_out = out_ptr;
-    z.avail_out = m_header.block_size;
-    inflateInit(&z);
-    int status = inflate(&z, Z_FULL_FLUSH);
-    u32 uncomp_size = m_header.block_size - z.avail_out;
-    if (status != Z_STREAM_END)
-    {
-      // this seem to fire wrongly from time to time
-      // to be sure, don't use compressed isos :P
-      ERROR_LOG_FMT(DISCIO, "Failure reading block {} - out of data and not at end.", block_num);
-    }
-    inflateEnd(&z);
-    if (uncomp_size != m_header.block_size)
+
+  const auto decompress_range = [this, block_num, first_offset, out_ptr](u64 start, u64 end) {
+    bool success = true;
+    for (u64 i = start; i < end; ++i)
     {
-      ERROR_LOG_FMT(DISCIO, "Wrong block size");
-      return false;
+      const u8* in = m_run_buffer.data() + (GetBlockFileOffset(block_num + i) - first_offset);
+      const u32 comp_block_size = static_cast<u32>(GetBlockCompressedSize(block_num + i));
+      if (!DecompressBlock(block_num + i, in, comp_block_size, out_ptr + i * m_header.block_size))
+        success = false;
     }
+    return success;
+  };
+
+  // Blocks are independent of each other, so longer runs can be split across threads.
+  const u64 threads =
+      std::min<u64>(num_blocks / GCZ_MIN_BLOCKS_PER_THREAD,
+                    std::max<unsigned int>(1, std::thread::hardware_concurrency()));
+  if (threads <= 1)
+    return decompress_range(0, num_blocks);
+
+  std::vector<std::future<bool>> decompress_futures(threads - 1);
+  for (u64 i = 1; i < threads; ++i)
+  {
+    decompress_futures[i - 1] =
+        std::async(std::launch::async, decompress_range, i * num_blocks / threads,
+                   (i + 1) * num_blocks / threads);
   }
-  return true;
+
+  bool success = decompress_range(0, num_blocks / threads);
+  for (std::future<bool>& future : decompress_futures)
+    success &= future.get();
+
+  return success;
 }
 
 struct CompressThreadState
@@ -64,9 +64,18 @@ public:
   u64 GetBlockCompressedSize(u64 block_num) const;
   bool GetBlock(u64 block_num, u8* out_ptr) override;
 
+protected:
+  bool ReadMultipleAlignedBlocks(u64 block_num, u64 num_blocks, u8* out_ptr) override;
+
 private:
   CompressedBlobReader(File::IOFile file, const std::string& filename);
 
+  u64 GetBlockFileOffset(u64 block_num) const;
+  bool IsBlockCompressed(u64 block_num) const;
+
+  // Thread-safe as long as the output buffers don't overlap.
+  bool DecompressBlock(u64 block_num, const u8* in, u32 comp_block_size, u8* out_ptr) const;
+
   CompressedBlobHeader m_header;
   std::vector<u64> m_block_pointers;
   std::vector<u32> m_hashes;
@@ -74,6 +83,7 @@ private:
   File::IOFile m_file;
   u64 m_file_size;
   std::vector<u8> m_zlib_buffer;
+  std::vector<u8> m_run_buffer;
   std::string m_file_name;
 };
 
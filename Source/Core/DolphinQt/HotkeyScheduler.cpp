@@ -149,6 +149,8 @@ void HotkeyScheduler::Run()
 {
   Common::SetCurrentThreadName("HotkeyScheduler");
 
+  bool was_throttle_hotkey_held = false;
+
   while (!m_stop_requested.IsSet())
   {
     Common::SleepCurrentThread(5);
@@ -474,7 +476,14 @@ void HotkeyScheduler::Run()
       if (IsHotkey(HK_TOGGLE_TEXTURES))
         Config::SetCurrent(Config::GFX_HIRES_TEXTURES, !Config::Get(Config::GFX_HIRES_TEXTURES));
 
-      Core::SetIsThrottlerTempDisabled(IsHotkey(HK_TOGGLE_THROTTLE, true));
+      // Only follow changes of the hotkey, so that other users of the temporary throttle override
+      // (like seeking in a movie) aren't undone on the next poll.
+      const bool throttle_hotkey_held = IsHotkey(HK_TOGGLE_THROTTLE, true);
+      if (throttle_hotkey_held != was_throttle_hotkey_held)
+      {
+        Core::SetIsThrottlerTempDisabled(throttle_hotkey_held);
+        was_throttle_hotkey_held = throttle_hotkey_held;
+      }
 
       auto ShowEmulationSpeed = []() {
         const float emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
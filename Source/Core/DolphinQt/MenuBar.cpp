@@ -3,8 +3,10 @@
 
 #include "DolphinQt/MenuBar.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <future>
+#include <limits>
 
 #include <QAction>
 #include <QActionGroup>
@@ -137,6 +139,7 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   {
     m_recording_stop->setEnabled(false);
     m_recording_export->setEnabled(false);
+    m_recording_seek->setEnabled(false);
   }
   m_recording_play->setEnabled(m_game_selected && !running);
   m_recording_play->setEnabled(m_game_selected && !running && !hardcore);
@@ -782,11 +785,14 @@ void MenuBar::AddMovieMenu()
                                            [this] { emit StopRecording(); });
   m_recording_export =
       movie_menu->addAction(tr("Export Recording..."), this, [this] { emit ExportRecording(); });
+  m_recording_seek =
+      movie_menu->addAction(tr("Seek to Frame..."), this, &MenuBar::SeekMovieToFrame);
 
   m_recording_start->setEnabled(false);
   m_recording_play->setEnabled(false);
   m_recording_stop->setEnabled(false);
   m_recording_export->setEnabled(false);
+  m_recording_seek->setEnabled(false);
 
   m_recording_read_only = movie_menu->addAction(tr("&Read-Only Mode"));
   m_recording_read_only->setCheckable(true);
@@ -804,6 +810,12 @@ void MenuBar::AddMovieMenu()
   connect(pause_at_end, &QAction::toggled,
           [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_MOVIE_PAUSE_MOVIE, value); });
 
+  auto* save_keyframes = movie_menu->addAction(tr("Save Keyframes for Seeking"));
+  save_keyframes->setCheckable(true);
+  save_keyframes->setChecked(Config::Get(Config::MAIN_MOVIE_SAVE_KEYFRAMES));
+  connect(save_keyframes, &QAction::toggled,
+          [](bool value) { Config::SetBaseOrCurrent(Config::MAIN_MOVIE_SAVE_KEYFRAMES, value); });
+
   auto* rerecord_counter = movie_menu->addAction(tr("Show Rerecord Counter"));
   rerecord_counter->setCheckable(true);
   rerecord_counter->setChecked(Config::Get(Config::MAIN_MOVIE_SHOW_RERECORD));
@@ -1270,6 +1282,36 @@ void MenuBar::OnRecordingStatusChanged(bool recording)
   m_recording_start->setEnabled(!recording && (m_game_selected || Core::IsRunning(system)));
   m_recording_stop->setEnabled(recording);
   m_recording_export->setEnabled(recording);
+  m_recording_seek->setEnabled(recording);
+}
+
+void MenuBar::SeekMovieToFrame()
+{
+  auto& movie = Core::System::GetInstance().GetMovie();
+  if (!movie.IsPlayingInput())
+  {
+    ModalMessageBox::information(this, tr("Seek to Frame"),
+                                 tr("Seeking is only possible while playing back a movie."));
+    return;
+  }
+
+  if (!movie.IsReadOnly())
+  {
+    ModalMessageBox::information(this, tr("Seek to Frame"),
+                                 tr("Seeking is only possible in read-only mode."));
+    return;
+  }
+
+  bool good;
+  const int frame = QInputDialog::getInt(
+      this, tr("Seek to Frame"), tr("Frame (1-%1):").arg(movie.GetTotalFrames()),
+      static_cast<int>(movie.GetCurrentFrame()), 1,
+      static_cast<int>(std::min<u64>(movie.GetTotalFrames(), std::numeric_limits<int>::max())),
+      1, &good, Qt::WindowCloseButtonHint);
+  if (!good)
+    return;
+
+  movie.SeekToFrame(static_cast<u64>(frame));
 }
 
 void MenuBar::OnReadOnlyModeChanged(bool read_only)
@@ -183,6 +183,7 @@ private:
 
   void OnSelectionChanged(std::shared_ptr<const UICommon::GameFile> game_file);
   void OnRecordingStatusChanged(bool recording);
+  void SeekMovieToFrame();
   void OnReadOnlyModeChanged(bool read_only);
   void OnDebugModeToggled(bool enabled);
   void OnWriteJitBlockLogDump();
@@ -232,6 +233,7 @@ private:
 
   // Movie
   QAction* m_recording_export;
+  QAction* m_recording_seek;
   QAction* m_recording_play;
   QAction* m_recording_start;
   QAction* m_recording_stop;
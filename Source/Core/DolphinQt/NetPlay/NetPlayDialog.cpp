@@ -19,6 +19,7 @@
 #include <QSignalBlocker>
 #include <QSpinBox>
 #include <QSplitter>
+#include <QStringList>
 #include <QTableWidget>
 #include <QTextBrowser>
 
@@ -90,6 +91,31 @@ QString InetAddressToString(const Common::TraversalInetAddress& addr)
 
   return QStringLiteral("%1:%2").arg(ip, QString::number(ntohs(addr.port)));
 }
+
+QString LatencyHistogramToString(const NetPlay::LatencyHistogram& histogram)
+{
+  QStringList lines;
+  for (size_t i = 0; i < histogram.buckets.size(); ++i)
+  {
+    const u32 count = histogram.buckets[i];
+    if (count == 0)
+      continue;
+
+    const u32 start = NetPlay::LatencyHistogram::GetBucketStart(i);
+    if (i + 1 == histogram.buckets.size())
+    {
+      lines.append(QObject::tr("%1+ ms: %2").arg(start).arg(count));
+    }
+    else
+    {
+      lines.append(QObject::tr("%1-%2 ms: %3")
+                       .arg(start)
+                       .arg(NetPlay::LatencyHistogram::GetBucketStart(i + 1))
+                       .arg(count));
+    }
+  }
+  return lines.join(QLatin1Char('\n'));
+}
 }  // namespace
 
 NetPlayDialog::NetPlayDialog(const GameListModel& game_list_model,
@@ -667,7 +693,14 @@ void NetPlayDialog::UpdateGUI()
     auto* status_item = new QTableWidgetItem(status_info.first);
     status_item->setToolTip(status_info.second);
     auto* ping_item = new QTableWidgetItem(QStringLiteral("%1 ms").arg(p->ping));
-    ping_item->setToolTip(ping_item->text());
+    QString ping_tooltip = tr("Round-trip time:") + QLatin1Char('\n') +
+                           LatencyHistogramToString(p->ping_histogram);
+    if (server && p->IsHost())
+    {
+      ping_tooltip += QStringLiteral("\n\n") + tr("Send queue latency:") + QLatin1Char('\n') +
+                      LatencyHistogramToString(server->GetQueueLatency());
+    }
+    ping_item->setToolTip(ping_tooltip);
     auto* mapping_item =
         new QTableWidgetItem(QString::fromStdString(NetPlay::GetPlayerMappingString(
             p->pid, client->GetPadMapping(), client->GetGBAConfig(), client->GetWiimoteMapping())));
@@ -7,6 +7,7 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -26,6 +27,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
 #include "Common/FileUtil.h"
+#include "Common/Hash.h"
 #include "Common/HttpRequest.h"
 #include "Common/IOFile.h"
 #include "Common/Image.h"
@@ -99,11 +101,57 @@ GameFile::LookupUsingConfigLanguage(const std::map<DiscIO::Language, std::string
   return Lookup(GetConfigLanguage(), strings);
 }
 
+void GameFileFingerprint::DoState(PointerWrap& p)
+{
+  p.Do(size);
+  p.Do(modification_time);
+  p.Do(partial_hash);
+}
+
+GameFileFingerprint GetGameFileFingerprint(const std::string& path, bool compute_partial_hash)
+{
+  GameFileFingerprint fingerprint;
+
+  std::error_code error;
+  const std::filesystem::path fs_path = StringToPath(path);
+  const std::uintmax_t size = std::filesystem::file_size(fs_path, error);
+  if (!error)
+    fingerprint.size = size;
+  const auto modification_time = std::filesystem::last_write_time(fs_path, error);
+  if (!error)
+    fingerprint.modification_time = modification_time.time_since_epoch().count();
+
+  if (compute_partial_hash)
+  {
+    // Hashing the whole file would take far too long for disc images, especially when they are
+    // stored on a network drive. The headers at the start and end catch most changes.
+    constexpr u64 CHUNK_SIZE = 0x10000;
+    std::vector<u8> buffer(std::min(fingerprint.size, CHUNK_SIZE));
+    File::IOFile file(path, "rb");
+    u32 crc = Common::StartCRC32();
+    if (file.ReadBytes(buffer.data(), buffer.size()))
+      crc = Common::UpdateCRC32(crc, buffer.data(), buffer.size());
+    if (fingerprint.size > CHUNK_SIZE)
+    {
+      const s64 end_offset = static_cast<s64>(fingerprint.size - CHUNK_SIZE);
+      if (file.Seek(end_offset, File::SeekOrigin::Begin) &&
+          file.ReadBytes(buffer.data(), buffer.size()))
+      {
+        crc = Common::UpdateCRC32(crc, buffer.data(), buffer.size());
+      }
+    }
+    fingerprint.partial_hash = crc;
+  }
+
+  return fingerprint;
+}
+
 GameFile::GameFile() = default;
 
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  m_fingerprint = GetGameFileFingerprint(m_file_path, true);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -296,6 +344,7 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_valid);
   p.Do(m_file_path);
   p.Do(m_file_name);
+  m_fingerprint.DoState(p);
 
   p.Do(m_file_size);
   p.Do(m_volume_size);
@@ -41,6 +41,22 @@ struct GameCover
   void DoState(PointerWrap& p);
 };
 
+// Identifies the version of a file on the host, so that GameFileCache can tell whether a file
+// has changed without opening it.
+struct GameFileFingerprint
+{
+  u64 size{};
+  s64 modification_time{};
+  // CRC32 of the start and the end of the file. Only computed when explicitly requested,
+  // since unlike the other fields, it requires opening the file.
+  u32 partial_hash{};
+
+  bool operator==(const GameFileFingerprint&) const = default;
+  void DoState(PointerWrap& p);
+};
+
+GameFileFingerprint GetGameFileFingerprint(const std::string& path, bool compute_partial_hash);
+
 // This class caches the metadata of a DiscIO::Volume (or a DOL/ELF file).
 class GameFile final
 {
@@ -58,6 +74,8 @@ public:
 
   bool IsValid() const;
   const std::string& GetFilePath() const { return m_file_path; }
+  const GameFileFingerprint& GetFingerprint() const { return m_fingerprint; }
+  void SetFingerprint(const GameFileFingerprint& fingerprint) { m_fingerprint = fingerprint; }
   const std::string& GetFileName() const { return m_file_name; }
   const std::string& GetName(const Core::TitleDatabase& title_database) const;
   const std::string& GetName(Variant variant) const;
@@ -144,6 +162,7 @@ private:
   bool m_valid{};
   std::string m_file_path;
   std::string m_file_name;
+  GameFileFingerprint m_fingerprint{};
 
   u64 m_file_size{};
   u64 m_volume_size{};
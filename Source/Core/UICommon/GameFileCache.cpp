@@ -4,12 +4,18 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
+#include <cstring>
 #include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -19,6 +25,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Thread.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -26,7 +33,149 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 25;  // Last changed in PR 12702
+static constexpr u32 CACHE_REVISION = 26;  // Last changed when the cache became append-only
+
+namespace
+{
+// Limits how many files are opened at once when scanning, which matters most for network drives.
+constexpr unsigned int MAX_SCAN_THREADS = 8;
+
+// Once this many superseded records have accumulated, the cache file is rewritten from scratch.
+constexpr size_t MAX_SUPERSEDED_RECORDS = 256;
+
+enum class RecordType : u8
+{
+  AddOrReplace = 0,
+  Remove = 1,
+};
+
+struct CacheFileHeader
+{
+  u32 revision;
+  u32 padding;
+};
+
+struct RecordHeader
+{
+  u32 size;
+  RecordType type;
+  std::array<u8, 3> padding;
+};
+
+template <typename DoStateFn>
+bool WriteRecord(File::IOFile& file, RecordType type, DoStateFn do_state)
+{
+  u8* ptr = nullptr;
+  PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+  do_state(p_measure);
+  const size_t size = reinterpret_cast<size_t>(ptr);
+
+  std::vector<u8> buffer(sizeof(RecordHeader) + size);
+  const RecordHeader header{static_cast<u32>(size), type, {}};
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  ptr = buffer.data() + sizeof(header);
+  PointerWrap p(&ptr, size, PointerWrap::Mode::Write);
+  do_state(p);
+
+  return file.WriteBytes(buffer.data(), buffer.size());
+}
+
+bool WriteGameFileRecord(File::IOFile& file, GameFile& game_file)
+{
+  return WriteRecord(file, RecordType::AddOrReplace, [&](PointerWrap& p) { game_file.DoState(p); });
+}
+
+// Calls job(i) for every i in [0, count) on a bounded number of worker threads, and calls
+// on_result(i, result) on the calling thread as results come in.
+template <typename Job, typename OnResult>
+void RunInParallel(size_t count, const Job& job, const OnResult& on_result,
+                   const std::atomic_bool& processing_halted)
+{
+  using Result = std::invoke_result_t<Job, size_t>;
+
+  const size_t num_threads = std::min<size_t>(
+      count, std::clamp(std::thread::hardware_concurrency(), 1u, MAX_SCAN_THREADS));
+
+  std::mutex mutex;
+  std::condition_variable results_available;
+  std::vector<std::pair<size_t, Result>> results;
+  size_t threads_running = num_threads;
+  std::atomic<size_t> next_index = 0;
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back([&] {
+      Common::SetCurrentThreadName("Game list scanner");
+      while (!processing_halted)
+      {
+        const size_t index = next_index++;
+        if (index >= count)
+          break;
+        Result result = job(index);
+
+        std::lock_guard lk(mutex);
+        results.emplace_back(index, std::move(result));
+        results_available.notify_one();
+      }
+
+      std::lock_guard lk(mutex);
+      --threads_running;
+      results_available.notify_one();
+    });
+  }
+
+  std::vector<std::pair<size_t, Result>> batch;
+  while (true)
+  {
+    {
+      std::unique_lock lk(mutex);
+      results_available.wait(lk, [&] { return !results.empty() || threads_running == 0; });
+      if (results.empty())
+        break;
+      batch.swap(results);
+    }
+
+    for (auto& [index, result] : batch)
+      on_result(index, std::move(result));
+    batch.clear();
+  }
+
+  for (std::thread& thread : threads)
+    thread.join();
+}
+
+struct ScanResult
+{
+  // nullptr if the cached file is still up to date.
+  std::shared_ptr<GameFile> file;
+  // True if the file had to be parsed again, false if only its fingerprint changed.
+  bool rescanned = false;
+};
+
+ScanResult CheckForChanges(const GameFile& cached_file)
+{
+  const std::string& path = cached_file.GetFilePath();
+  const GameFileFingerprint& cached = cached_file.GetFingerprint();
+
+  GameFileFingerprint current = GetGameFileFingerprint(path, false);
+  if (current.size == cached.size && current.modification_time == cached.modification_time)
+    return {};
+
+  // The modification time also changes when a file is copied or touched, so check whether the
+  // contents are likely to be the same before going through the expensive full scan.
+  current = GetGameFileFingerprint(path, true);
+  if (current.size == cached.size && current.partial_hash == cached.partial_hash)
+  {
+    auto copy = std::make_shared<GameFile>(cached_file);
+    copy->SetFingerprint(current);
+    return {std::move(copy), false};
+  }
+
+  return {std::make_shared<GameFile>(path), true};
+}
+}  // namespace
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -60,6 +209,8 @@ void GameFileCache::Clear(DeleteOnDisk delete_on_disk)
     File::Delete(m_path);
 
   m_cached_files.clear();
+  m_changed_paths.clear();
+  m_cache_file_needs_rewrite = true;
 }
 
 std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
@@ -78,7 +229,10 @@ std::shared_ptr<const GameFile> GameFileCache::AddOrGet(const std::string& path,
   }
   std::shared_ptr<GameFile>& result = found ? *it : m_cached_files.back();
   if (UpdateAdditionalMetadata(&result) || !found)
+  {
     *cache_changed = true;
+    m_changed_paths.insert(path);
+  }
 
   return result;
 }
@@ -122,6 +276,7 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
           game_removed_from_cache((*it)->GetFilePath());
 
         cache_changed = true;
+        m_changed_paths.insert((*it)->GetFilePath());
         --end;
         *it = std::move(*end);
       }
@@ -129,23 +284,51 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
     m_cached_files.erase(it, m_cached_files.end());
   }
 
-  // Now that the previous loop has run, game_paths only contains paths that
-  // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
-  {
-    if (processing_halted)
-      break;
+  // Now that the previous loop has run, game_paths only contains paths that aren't in
+  // m_cached_files. Those need to be scanned, and the files that are in m_cached_files need to
+  // be checked for changes. Both are done on worker threads since they are dominated by I/O,
+  // while m_cached_files is only modified on this thread.
+  const std::vector<std::shared_ptr<GameFile>> files_to_check = m_cached_files;
+  const std::vector<std::string> paths_to_scan(game_paths.begin(), game_paths.end());
+
+  const auto job = [&](size_t index) -> ScanResult {
+    if (index < files_to_check.size())
+      return CheckForChanges(*files_to_check[index]);
+    return {std::make_shared<GameFile>(paths_to_scan[index - files_to_check.size()]), true};
+  };
+
+  bool files_removed = false;
+  const auto on_result = [&](size_t index, ScanResult result) {
+    if (!result.file)
+      return;
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
-    {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+    const std::string path = result.file->GetFilePath();
+    const bool was_cached = index < files_to_check.size();
+    if (was_cached && result.rescanned && game_removed_from_cache)
+      game_removed_from_cache(path);
+    if (result.rescanned && result.file->IsValid() && game_added_to_cache)
+      game_added_to_cache(result.file);
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
+    if (!result.file->IsValid())
+    {
+      if (!was_cached)
+        return;
+      files_removed = true;
+      result.file.reset();
     }
-  }
+
+    cache_changed = true;
+    m_changed_paths.insert(path);
+    if (was_cached)
+      m_cached_files[index] = std::move(result.file);
+    else
+      m_cached_files.push_back(std::move(result.file));
+  };
+
+  RunInParallel(files_to_check.size() + paths_to_scan.size(), job, on_result, processing_halted);
+
+  if (files_removed)
+    std::erase(m_cached_files, nullptr);
 
   return cache_changed;
 }
@@ -155,16 +338,25 @@ bool GameFileCache::UpdateAdditionalMetadata(const GameUpdatedFn& game_updated,
 {
   bool cache_changed = false;
 
-  for (std::shared_ptr<GameFile>& file : m_cached_files)
-  {
-    if (processing_halted)
-      break;
+  const std::vector<std::shared_ptr<GameFile>> files = m_cached_files;
 
-    const bool updated = UpdateAdditionalMetadata(&file);
-    cache_changed |= updated;
-    if (game_updated && updated)
-      game_updated(file);
-  }
+  const auto job = [&](size_t index) {
+    std::shared_ptr<GameFile> file = files[index];
+    return UpdateAdditionalMetadata(&file) ? file : nullptr;
+  };
+
+  const auto on_result = [&](size_t index, std::shared_ptr<GameFile> updated_file) {
+    if (!updated_file)
+      return;
+
+    cache_changed = true;
+    m_changed_paths.insert(updated_file->GetFilePath());
+    m_cached_files[index] = updated_file;
+    if (game_updated)
+      game_updated(updated_file);
+  };
+
+  RunInParallel(files.size(), job, on_result, processing_halted);
 
   return cache_changed;
 }
@@ -208,79 +400,178 @@ bool GameFileCache::UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_fil
 
 bool GameFileCache::Load()
 {
-  return SyncCacheFile(false);
+  if (ReadCacheFile())
+    return true;
+
+  // If some file operation failed, try to delete the probably-corrupted cache
+  File::Delete(m_path);
+  m_cached_files.clear();
+  m_cache_file_needs_rewrite = true;
+  return false;
 }
 
 bool GameFileCache::Save()
 {
-  return SyncCacheFile(true);
+  // Appending would leave too many records that have been superseded by later ones.
+  const bool too_many_superseded_records = m_records_in_cache_file + m_changed_paths.size() >
+                                           m_cached_files.size() + MAX_SUPERSEDED_RECORDS;
+
+  bool success;
+  if (m_cache_file_needs_rewrite || too_many_superseded_records)
+    success = RewriteCacheFile();
+  else
+    success = AppendToCacheFile();
+
+  if (success)
+  {
+    m_changed_paths.clear();
+    m_cache_file_needs_rewrite = false;
+  }
+  else
+  {
+    File::Delete(m_path);
+    m_cache_file_needs_rewrite = true;
+  }
+  return success;
 }
 
-bool GameFileCache::SyncCacheFile(bool save)
+bool GameFileCache::ReadCacheFile()
 {
-  const char* open_mode = save ? "wb" : "rb";
-  File::IOFile f(m_path, open_mode);
+  File::IOFile f(m_path, "rb");
   if (!f)
     return false;
-  bool success = false;
-  if (save)
-  {
-    // Measure the size of the buffer.
-    u8* ptr = nullptr;
-    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
-    DoState(&p_measure);
-    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
-
-    // Then actually do the write.
-    std::vector<u8> buffer(buffer_size);
-    ptr = buffer.data();
-    PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
-    DoState(&p, buffer_size);
-    if (f.WriteBytes(buffer.data(), buffer.size()))
-      success = true;
-  }
-  else
+
+  std::vector<u8> buffer(f.GetSize());
+  if (buffer.size() < sizeof(CacheFileHeader) || !f.ReadBytes(buffer.data(), buffer.size()))
+    return false;
+
+  CacheFileHeader header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  if (header.revision != CACHE_REVISION)
+    return false;
+
+  m_cached_files.clear();
+  m_changed_paths.clear();
+  m_records_in_cache_file = 0;
+  m_cache_file_needs_rewrite = false;
+
+  std::unordered_map<std::string, size_t> indices;
+  const auto remove = [&](const std::string& path) {
+    const auto it = indices.find(path);
+    if (it == indices.end())
+      return;
+    const size_t index = it->second;
+    indices.erase(it);
+    if (index != m_cached_files.size() - 1)
+    {
+      m_cached_files[index] = std::move(m_cached_files.back());
+      indices[m_cached_files[index]->GetFilePath()] = index;
+    }
+    m_cached_files.pop_back();
+  };
+
+  size_t offset = sizeof(CacheFileHeader);
+  while (offset < buffer.size())
   {
-    std::vector<u8> buffer(f.GetSize());
-    if (!buffer.empty() && f.ReadBytes(buffer.data(), buffer.size()))
+    RecordHeader record;
+    if (buffer.size() - offset < sizeof(record))
+      break;
+    std::memcpy(&record, buffer.data() + offset, sizeof(record));
+    offset += sizeof(record);
+    if (buffer.size() - offset < record.size)
+      break;
+
+    u8* ptr = buffer.data() + offset;
+    PointerWrap p(&ptr, record.size, PointerWrap::Mode::Read);
+    offset += record.size;
+    if (record.type == RecordType::AddOrReplace)
+    {
+      auto file = std::make_shared<GameFile>();
+      file->DoState(p);
+      if (!p.IsReadMode())
+        break;
+      remove(file->GetFilePath());
+      indices.emplace(file->GetFilePath(), m_cached_files.size());
+      m_cached_files.push_back(std::move(file));
+    }
+    else if (record.type == RecordType::Remove)
+    {
+      std::string path;
+      p.Do(path);
+      if (!p.IsReadMode())
+        break;
+      remove(path);
+    }
+    else
     {
-      u8* ptr = buffer.data();
-      PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
-      DoState(&p, buffer.size());
-      if (p.IsReadMode())
-        success = true;
+      break;
     }
+    ++m_records_in_cache_file;
   }
-  if (!success)
+
+  // A record may have been cut off if Dolphin was closed while appending to the cache file.
+  // Keep what could be read, and write a clean cache file the next time it's saved.
+  if (offset != buffer.size())
+    m_cache_file_needs_rewrite = true;
+
+  return true;
+}
+
+bool GameFileCache::RewriteCacheFile()
+{
+  const std::string temp_path = File::GetTempFilenameForAtomicWrite(m_path);
   {
-    // If some file operation failed, try to delete the probably-corrupted cache
-    f.Close();
-    File::Delete(m_path);
+    File::IOFile f(temp_path, "wb");
+    const CacheFileHeader header{CACHE_REVISION, 0};
+    if (!f.WriteArray(&header, 1))
+      return false;
+    for (const std::shared_ptr<GameFile>& file : m_cached_files)
+    {
+      if (!WriteGameFileRecord(f, *file))
+        return false;
+    }
   }
-  return success;
+
+  if (!File::Rename(temp_path, m_path))
+    return false;
+
+  m_records_in_cache_file = m_cached_files.size();
+  return true;
 }
 
-void GameFileCache::DoState(PointerWrap* p, u64 size)
+bool GameFileCache::AppendToCacheFile()
 {
-  struct
-  {
-    u32 revision;
-    u64 expected_size;
-  } header = {CACHE_REVISION, size};
-  p->Do(header);
-  if (p->IsReadMode())
+  if (m_changed_paths.empty())
+    return true;
+
+  File::IOFile f(m_path, "ab");
+  if (!f)
+    return false;
+
+  std::unordered_map<std::string_view, GameFile*> files_by_path;
+  files_by_path.reserve(m_cached_files.size());
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
+    files_by_path.emplace(file->GetFilePath(), file.get());
+
+  for (const std::string& path : m_changed_paths)
   {
-    if (header.revision != CACHE_REVISION || header.expected_size != size)
+    const auto it = files_by_path.find(path);
+    bool success;
+    if (it != files_by_path.end())
     {
-      p->SetMeasureMode();
-      return;
+      success = WriteGameFileRecord(f, *it->second);
     }
+    else
+    {
+      std::string removed_path = path;
+      success = WriteRecord(f, RecordType::Remove, [&](PointerWrap& p) { p.Do(removed_path); });
+    }
+    if (!success)
+      return false;
+    ++m_records_in_cache_file;
   }
-  p->DoEachElement(m_cached_files, [](PointerWrap& state, std::shared_ptr<GameFile>& elem) {
-    if (state.IsReadMode())
-      elem = std::make_shared<GameFile>();
-    elem->DoState(state);
-  });
+
+  return true;
 }
 
 }  // namespace UICommon
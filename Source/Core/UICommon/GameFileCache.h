@@ -9,12 +9,11 @@
 #include <memory>
 #include <span>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
 
-class PointerWrap;
-
 namespace UICommon
 {
 class GameFile;
@@ -60,11 +59,19 @@ public:
 private:
   bool UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_file);
 
-  bool SyncCacheFile(bool save);
-  void DoState(PointerWrap* p, u64 size = 0);
+  bool ReadCacheFile();
+  bool RewriteCacheFile();
+  bool AppendToCacheFile();
 
   std::string m_path;
   std::vector<std::shared_ptr<GameFile>> m_cached_files;
+
+  // The cache file is a log of records. Each record adds (or replaces) or removes one file,
+  // so saving only needs to append records for the paths that changed since the last save.
+  std::unordered_set<std::string> m_changed_paths;
+  // Number of records in the cache file, including superseded ones.
+  size_t m_records_in_cache_file = 0;
+  bool m_cache_file_needs_rewrite = true;
 };
 
 }  // namespace UICommon
@@ -357,6 +357,22 @@ void CommandProcessorManager::RegisterMMIO(MMIO::Mapping* mmio, u32 base)
   mmio->Register(base | FIFO_READ_POINTER_HI, fifo_read_hi_r, fifo_read_hi_w);
 }
 
+// Returns whether GatherPipeBursted leaves the processor interface's FIFO alone, other than
+// advancing its write pointer by one burst, so that several bursts can be written at once.
+bool CommandProcessorManager::CanBatchGatherPipeBursts() const
+{
+  if (!m_cp_ctrl_reg.GPReadEnable || !m_cp_ctrl_reg.GPLinkEnable)
+    return true;
+
+  // Each burst points the processor interface at the CP FIFO, which only changes nothing if both
+  // already describe the same FIFO. They then advance in lockstep.
+  const auto& processor_interface = m_system.GetProcessorInterface();
+  return processor_interface.m_fifo_cpu_write_pointer ==
+             m_fifo.CPWritePointer.load(std::memory_order_relaxed) &&
+         processor_interface.m_fifo_cpu_base == m_fifo.CPBase.load(std::memory_order_relaxed) &&
+         processor_interface.m_fifo_cpu_end == m_fifo.CPEnd.load(std::memory_order_relaxed);
+}
+
 void CommandProcessorManager::GatherPipeBursted()
 {
   SetCPStatusFromCPU();
@@ -3,6 +3,7 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 
@@ -28,6 +29,7 @@
 #include "VideoCommon/DataReader.h"
 #include "VideoCommon/FramebufferManager.h"
 #include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VertexLoaderManager.h"
 #include "VideoCommon/VertexManagerBase.h"
 #include "VideoCommon/VideoBackendBase.h"
@@ -36,6 +38,14 @@ namespace Fifo
 {
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
 
+// How much data the CPU thread preprocesses before waking up the GPU thread.
+static constexpr u32 GPU_WAKEUP_BATCH_SIZE = 32 * GPFifo::GATHER_PIPE_SIZE;
+
+// Bounds for how much free space may be left at the end of the video buffer when it is compacted
+// early, see ReadDataFromFifoOnCPU.
+static constexpr size_t MIN_COMPACTION_SLACK = 64 * 1024;
+static constexpr size_t MAX_COMPACTION_SLACK = 512 * 1024;
+
 FifoManager::FifoManager(Core::System& system) : m_system{system}
 {
 }
@@ -150,7 +160,16 @@ void FifoManager::SyncGPU(SyncGPUReason reason, bool may_move_read_ptr)
 {
   if (m_use_deterministic_gpu_thread)
   {
-    m_gpu_mainloop.Wait();
+    // The GPU thread must have been told about everything we want it to finish.
+    if (m_unsignaled_bytes != 0)
+      WakeupGpuThread();
+
+    if (!m_gpu_mainloop.IsDone())
+    {
+      const TimePoint start = Clock::now();
+      m_gpu_mainloop.Wait();
+      g_perf_metrics.CountGPUSyncStall(reason, Clock::now() - start);
+    }
     if (!m_gpu_mainloop.IsRunning())
       return;
 
@@ -240,7 +259,14 @@ void FifoManager::ReadDataFromFifo(u32 read_ptr)
 void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr)
 {
   u8* write_ptr = m_video_buffer_write_ptr;
-  if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(m_video_buffer + FIFO_SIZE - write_ptr))
+  UpdateGpuLag(write_ptr);
+
+  // If the GPU thread has caught up, we can move the remaining data back to the start of the
+  // buffer almost for free. Doing this a bit before the end of the buffer is reached avoids having
+  // to wait for the GPU thread to drain a full buffer when we do run out of space.
+  const size_t free_space = static_cast<size_t>(m_video_buffer + FIFO_SIZE - write_ptr);
+  const bool gpu_idle = m_unsignaled_bytes == 0 && m_video_buffer_seen_ptr == write_ptr;
+  if (GPFifo::GATHER_PIPE_SIZE > free_space || (gpu_idle && free_space < GetCompactionSlack()))
   {
     // We can't wrap around while the GPU is working on the data.
     // This should be very rare due to the reset in SyncGPU.
@@ -271,6 +297,31 @@ void FifoManager::ReadDataFromFifoOnCPU(u32 read_ptr)
       DataReader(m_video_buffer_pp_read_ptr, write_ptr + GPFifo::GATHER_PIPE_SIZE), nullptr);
   // This would have to be locked if the GPU thread didn't spin.
   m_video_buffer_write_ptr = write_ptr + GPFifo::GATHER_PIPE_SIZE;
+  m_unsignaled_bytes += GPFifo::GATHER_PIPE_SIZE;
+}
+
+void FifoManager::WakeupGpuThread()
+{
+  m_unsignaled_bytes = 0;
+  m_gpu_mainloop.Wakeup();
+}
+
+void FifoManager::UpdateGpuLag(const u8* write_ptr)
+{
+  const u8* seen_ptr = m_video_buffer_seen_ptr;
+  const u32 lag = write_ptr > seen_ptr ? static_cast<u32>(write_ptr - seen_ptr) : 0;
+
+  // Exponential moving average with a weight of 1/16 for the new sample.
+  const s64 delta = static_cast<s64>(lag) - static_cast<s64>(m_gpu_lag_average);
+  m_gpu_lag_average = static_cast<u32>(m_gpu_lag_average + delta / 16);
+}
+
+size_t FifoManager::GetCompactionSlack() const
+{
+  // Leave room for a few times the amount of data the GPU thread usually has queued up, so that
+  // the GPU thread is likely to have caught up at some point before the buffer runs out.
+  return std::clamp<size_t>(size_t{m_gpu_lag_average} * 4, MIN_COMPACTION_SLACK,
+                            MAX_COMPACTION_SLACK);
 }
 
 void FifoManager::ResetVideoBuffer()
@@ -281,6 +332,8 @@ void FifoManager::ResetVideoBuffer()
   m_video_buffer_pp_read_ptr = m_video_buffer;
   m_fifo_aux_write_ptr = m_fifo_aux_data;
   m_fifo_aux_read_ptr = m_fifo_aux_data;
+  m_unsignaled_bytes = 0;
+  m_gpu_lag_average = 0;
 }
 
 // Description: Main FIFO update loop
@@ -453,7 +506,8 @@ int FifoManager::RunGpuOnCpu(int ticks)
     if (m_use_deterministic_gpu_thread)
     {
       ReadDataFromFifoOnCPU(fifo.CPReadPointer.load(std::memory_order_relaxed));
-      m_gpu_mainloop.Wakeup();
+      if (m_unsignaled_bytes >= GPU_WAKEUP_BATCH_SIZE)
+        WakeupGpuThread();
     }
     else
     {
@@ -484,6 +538,9 @@ int FifoManager::RunGpuOnCpu(int ticks)
     fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_relaxed);
   }
 
+  if (m_unsignaled_bytes != 0)
+    WakeupGpuThread();
+
   command_processor.SetCPStatusFromGPU();
 
   if (reset_simd_state)
@@ -559,7 +616,11 @@ int FifoManager::WaitForGpuThread(int ticks)
 
   // Wait for GPU
   if (now >= m_config_sync_gpu_max_distance)
+  {
+    const TimePoint start = Clock::now();
     m_sync_wakeup_event.Wait();
+    g_perf_metrics.CountGPUSyncStall(SyncGPUReason::MaxDistance, Clock::now() - start);
+  }
 
   return GPU_TIME_SLOT_SIZE;
 }
@@ -36,7 +36,10 @@ enum class SyncGPUReason
   BBox,
   Swap,
   AuxSpace,
+  // The CPU thread got too far ahead of the GPU thread with SyncGPU enabled.
+  MaxDistance,
 };
+constexpr size_t NUM_SYNC_GPU_REASONS = static_cast<size_t>(SyncGPUReason::MaxDistance) + 1;
 
 class FifoManager final
 {
@@ -81,6 +84,9 @@ private:
   void ReadDataFromFifoOnCPU(u32 read_ptr);
   int RunGpuOnCpu(int ticks);
   int WaitForGpuThread(int ticks);
+  void WakeupGpuThread();
+  void UpdateGpuLag(const u8* write_ptr);
+  size_t GetCompactionSlack() const;
   static void SyncGPUCallback(Core::System& system, u64 ticks, s64 cyclesLate);
 
   static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
@@ -118,6 +124,13 @@ private:
   // polls, it's just atomic.
   // - The pp_read_ptr is the CPU preprocessing version of the read_ptr.
 
+  // In deterministic GPU thread mode, the GPU thread is only woken up once enough data has been
+  // preprocessed, rather than for every gather pipe burst. This is only touched by the CPU thread.
+  u32 m_unsignaled_bytes = 0;
+  // Running average of how many bytes the GPU thread is behind the CPU thread, in deterministic
+  // GPU thread mode. This decides how early the video buffer is compacted while the GPU is idle.
+  u32 m_gpu_lag_average = 0;
+
   std::atomic<int> m_sync_ticks = 0;
   bool m_syncing_suspended = false;
   Common::Event m_sync_wakeup_event;
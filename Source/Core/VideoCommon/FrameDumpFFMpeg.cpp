@@ -158,6 +158,42 @@ std::string AVErrorString(int error)
   return fmt::format("{:8x} {}", (u32)error, &msg[0]);
 }
 
+// The frame API of libswscale 6.1 and later splits the conversion into slices that are processed
+// on several threads. Older versions can only convert on the calling thread.
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+#define SWS_HAS_SLICE_THREADS 1
+#endif
+
+SwsContext* CreateScaleContext(int width, int height, AVPixelFormat src_format,
+                               AVPixelFormat dst_format)
+{
+#if defined(SWS_HAS_SLICE_THREADS)
+  SwsContext* sws = sws_alloc_context();
+  if (!sws)
+    return nullptr;
+
+  av_opt_set_int(sws, "srcw", width, 0);
+  av_opt_set_int(sws, "srch", height, 0);
+  av_opt_set_int(sws, "src_format", src_format, 0);
+  av_opt_set_int(sws, "dstw", width, 0);
+  av_opt_set_int(sws, "dsth", height, 0);
+  av_opt_set_int(sws, "dst_format", dst_format, 0);
+  av_opt_set_int(sws, "sws_flags", SWS_BICUBIC, 0);
+  // Zero lets libswscale pick one thread per core.
+  av_opt_set_int(sws, "threads", 0, 0);
+
+  if (sws_init_context(sws, nullptr, nullptr) < 0)
+  {
+    sws_freeContext(sws);
+    return nullptr;
+  }
+  return sws;
+#else
+  return sws_getContext(width, height, src_format, width, height, dst_format, SWS_BICUBIC, nullptr,
+                        nullptr, nullptr);
+#endif
+}
+
 }  // namespace
 
 bool FFMpegFrameDump::Start(int w, int h, u64 start_ticks)
@@ -293,6 +329,11 @@ bool FFMpegFrameDump::CreateVideoFile()
   if (output_format->flags & AVFMT_GLOBALHEADER)
     m_context->codec->flags |= AV_CODEC_FLAG_GLOBAL_HEADER;
 
+  // Let the encoder work on several frames (or slices of a frame) at once. Zero picks a thread
+  // count based on the number of cores. Encoders without threading support ignore this.
+  m_context->codec->thread_count = 0;
+  m_context->codec->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
   if (avcodec_open2(m_context->codec, codec, nullptr) < 0)
   {
     ERROR_LOG_FMT(FRAMEDUMP, "Could not open codec");
@@ -309,6 +350,14 @@ bool FFMpegFrameDump::CreateVideoFile()
   if (av_frame_get_buffer(m_context->scaled_frame, 1))
     return false;
 
+  m_context->sws = CreateScaleContext(m_context->width, m_context->height, AV_PIX_FMT_RGBA,
+                                      m_context->codec->pix_fmt);
+  if (!m_context->sws)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not create color conversion context");
+    return false;
+  }
+
   m_context->stream = avformat_new_stream(m_context->format, codec);
   if (!m_context->stream ||
       avcodec_parameters_from_context(m_context->stream->codecpar, m_context->codec) < 0)
@@ -376,22 +425,56 @@ void FFMpegFrameDump::AddFrame(const FrameData& frame)
     }
   }
 
-  constexpr AVPixelFormat pix_fmt = AV_PIX_FMT_RGBA;
-
   m_context->src_frame->data[0] = const_cast<u8*>(frame.data);
   m_context->src_frame->linesize[0] = frame.stride;
-  m_context->src_frame->format = pix_fmt;
+  m_context->src_frame->format = AV_PIX_FMT_RGBA;
   m_context->src_frame->width = m_context->width;
   m_context->src_frame->height = m_context->height;
 
+  // With frame threading the encoder can still hold a reference to the previous frame's buffer,
+  // in which case a new one is needed rather than overwriting a frame in flight. A zero sized
+  // frame keeps the last image, so only then do the old contents have to be copied over.
+  const bool convert_frame = frame.width == m_context->width && frame.height == m_context->height;
+  int alloc_error = 0;
+  if (!convert_frame)
+  {
+    alloc_error = av_frame_make_writable(m_context->scaled_frame);
+  }
+  else if (!av_frame_is_writable(m_context->scaled_frame))
+  {
+    av_frame_unref(m_context->scaled_frame);
+    m_context->scaled_frame->format = m_context->codec->pix_fmt;
+    m_context->scaled_frame->width = m_context->width;
+    m_context->scaled_frame->height = m_context->height;
+    alloc_error = av_frame_get_buffer(m_context->scaled_frame, 1);
+  }
+
+  if (alloc_error)
+  {
+    ERROR_LOG_FMT(FRAMEDUMP, "Could not allocate frame: {}", AVErrorString(alloc_error));
+    return;
+  }
+
   // Convert image from RGBA to desired pixel format.
-  m_context->sws = sws_getCachedContext(
-      m_context->sws, frame.width, frame.height, pix_fmt, m_context->width, m_context->height,
-      m_context->codec->pix_fmt, SWS_BICUBIC, nullptr, nullptr, nullptr);
-  if (m_context->sws)
+  if (convert_frame)
   {
+#if defined(SWS_HAS_SLICE_THREADS)
+    // Wrap the mapped staging texture so libswscale references it instead of copying it.
+    m_context->src_frame->buf[0] =
+        av_buffer_create(m_context->src_frame->data[0], frame.stride * frame.height,
+                         [](void*, u8*) {}, nullptr, AV_BUFFER_FLAG_READONLY);
+    if (m_context->src_frame->buf[0])
+    {
+      const int error =
+          sws_scale_frame(m_context->sws, m_context->scaled_frame, m_context->src_frame);
+      if (error < 0)
+        ERROR_LOG_FMT(FRAMEDUMP, "Error converting frame: {}", AVErrorString(error));
+      av_buffer_unref(&m_context->src_frame->buf[0]);
+    }
+#else
     sws_scale(m_context->sws, m_context->src_frame->data, m_context->src_frame->linesize, 0,
               frame.height, m_context->scaled_frame->data, m_context->scaled_frame->linesize);
+#endif
   }
 
   m_context->last_pts = pts;
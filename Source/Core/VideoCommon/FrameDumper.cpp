@@ -3,6 +3,8 @@
 
 #include "VideoCommon/FrameDumper.h"
 
+#include <utility>
+
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/Image.h"
@@ -21,6 +23,9 @@
 // The video encoder needs the image to be a multiple of x samples.
 static constexpr int VIDEO_ENCODER_LCM = 4;
 
+// Number of frames that can be waiting for the encoder before the video thread has to wait.
+static constexpr size_t FRAME_DUMP_QUEUE_SIZE = 3;
+
 static bool DumpFrameToPNG(const FrameData& frame, const std::string& file_name)
 {
   return Common::ConvertRGBAToRGBAndSavePNG(file_name, frame.data, frame.width, frame.height,
@@ -105,7 +110,20 @@ bool FrameDumper::CheckFrameDumpReadbackTexture(u32 target_width, u32 target_hei
   if (rbtex && rbtex->GetWidth() == target_width && rbtex->GetHeight() == target_height)
     return true;
 
+  // Reuse a texture the dump thread has finished with, dropping any left over from a resize.
   rbtex.reset();
+  ReclaimFinishedFrames();
+  while (!m_frame_dump_free_textures.empty())
+  {
+    std::unique_ptr<AbstractStagingTexture> texture = std::move(m_frame_dump_free_textures.back());
+    m_frame_dump_free_textures.pop_back();
+    if (texture->GetWidth() == target_width && texture->GetHeight() == target_height)
+    {
+      rbtex = std::move(texture);
+      return true;
+    }
+  }
+
   rbtex = g_gfx->CreateStagingTexture(StagingTextureType::Readback,
                                       TextureConfig(target_width, target_height, 1, 1, 1,
                                                     AbstractTextureFormat::RGBA8, 0,
@@ -121,22 +139,29 @@ void FrameDumper::FlushFrameDump()
   if (!m_frame_dump_needs_flush)
     return;
 
-  // Ensure dumping thread is done with output texture before swapping.
-  FinishFrameData();
-
-  std::swap(m_frame_dump_output_texture, m_frame_dump_readback_texture);
+  // Only wait for the dumping thread when every texture in the ring is still being encoded.
+  ReclaimFinishedFrames();
+  if (m_frame_dump_output_textures.size() >= FRAME_DUMP_QUEUE_SIZE)
+  {
+    const auto stall_start = std::chrono::steady_clock::now();
+    WaitForQueuedFrames(FRAME_DUMP_QUEUE_SIZE - 1);
+    m_frame_dump_stall_time += std::chrono::steady_clock::now() - stall_start;
+    m_frame_dump_stall_count++;
+  }
 
   // Queue encoding of the last frame dumped.
-  auto& output = m_frame_dump_output_texture;
+  std::unique_ptr<AbstractStagingTexture> output = std::move(m_frame_dump_readback_texture);
   output->Flush();
   if (output->Map())
   {
-    DumpFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
-                  output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    QueueFrameData(reinterpret_cast<u8*>(output->GetMappedPointer()), output->GetConfig().width,
+                   output->GetConfig().height, static_cast<int>(output->GetMappedStride()));
+    m_frame_dump_output_textures.push_back(std::move(output));
   }
   else
   {
     ERROR_LOG_FMT(VIDEO, "Failed to map texture for dumping.");
+    m_frame_dump_free_textures.push_back(std::move(output));
   }
 
   m_frame_dump_needs_flush = false;
@@ -166,12 +191,29 @@ void FrameDumper::ShutdownFrameDumping()
   m_frame_dump_render_texture.reset();
 
   m_frame_dump_readback_texture.reset();
-  m_frame_dump_output_texture.reset();
+  m_frame_dump_output_textures.clear();
+  m_frame_dump_free_textures.clear();
+
+  if (m_frame_dump_stall_count != 0)
+  {
+    INFO_LOG_FMT(FRAMEDUMP, "Waited for the encoder on {} of {} frames ({} ms in total)",
+                 m_frame_dump_stall_count, m_frame_dump_frames_queued,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(m_frame_dump_stall_time)
+                     .count());
+  }
+  m_frame_dump_frames_queued = 0;
+  m_frame_dump_frames_done = 0;
+  m_frame_dump_stall_count = 0;
+  m_frame_dump_stall_time = {};
 }
 
-void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
+void FrameDumper::QueueFrameData(const u8* data, int w, int h, int stride)
 {
-  m_frame_dump_data = FrameData{data, w, h, stride, m_last_frame_state};
+  {
+    std::lock_guard<std::mutex> lk(m_frame_dump_queue_lock);
+    m_frame_dump_queue.push_back(FrameData{data, w, h, stride, m_last_frame_state});
+  }
+  m_frame_dump_frames_queued++;
 
   if (!m_frame_dump_thread_running.IsSet())
   {
@@ -183,18 +225,45 @@ void FrameDumper::DumpFrameData(const u8* data, int w, int h, int stride)
 
   // Wake worker thread up.
   m_frame_dump_start.Set();
-  m_frame_dump_frame_running = true;
 }
 
-void FrameDumper::FinishFrameData()
+std::optional<FrameData> FrameDumper::PopFrameData()
 {
-  if (!m_frame_dump_frame_running)
-    return;
+  std::lock_guard<std::mutex> lk(m_frame_dump_queue_lock);
+  if (m_frame_dump_queue.empty())
+    return std::nullopt;
 
-  m_frame_dump_done.Wait();
-  m_frame_dump_frame_running = false;
+  FrameData frame = m_frame_dump_queue.front();
+  m_frame_dump_queue.pop_front();
+  return frame;
+}
 
-  m_frame_dump_output_texture->Unmap();
+void FrameDumper::ReclaimFinishedFrames()
+{
+  // Frames are encoded in order, so the oldest output textures are the finished ones.
+  const u64 frames_done = m_frame_dump_frames_done.load(std::memory_order_acquire);
+  while (!m_frame_dump_output_textures.empty() &&
+         m_frame_dump_frames_queued - m_frame_dump_output_textures.size() < frames_done)
+  {
+    m_frame_dump_output_textures.front()->Unmap();
+    m_frame_dump_free_textures.push_back(std::move(m_frame_dump_output_textures.front()));
+    m_frame_dump_output_textures.pop_front();
+  }
+}
+
+void FrameDumper::WaitForQueuedFrames(size_t max_frames)
+{
+  ReclaimFinishedFrames();
+  while (m_frame_dump_output_textures.size() > max_frames)
+  {
+    m_frame_dump_done.Wait();
+    ReclaimFinishedFrames();
+  }
+}
+
+void FrameDumper::FinishFrameData()
+{
+  WaitForQueuedFrames(0);
 }
 
 void FrameDumper::FrameDumpThreadFunc()
@@ -220,46 +289,50 @@ void FrameDumper::FrameDumpThreadFunc()
     if (!m_frame_dump_thread_running.IsSet())
       break;
 
-    auto frame = m_frame_dump_data;
-
-    // Save screenshot
-    if (m_screenshot_request.TestAndClear())
+    while (const std::optional<FrameData> queued_frame = PopFrameData())
     {
-      std::lock_guard<std::mutex> lk(m_screenshot_lock);
-
-      if (DumpFrameToPNG(frame, m_screenshot_name))
-        OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+      const FrameData& frame = *queued_frame;
 
-      // Reset settings
-      m_screenshot_name.clear();
-      m_screenshot_completed.Set();
-    }
-
-    if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
-    {
-      if (!frame_dump_started)
+      // Save screenshot
+      if (m_screenshot_request.TestAndClear())
       {
-        if (dump_to_ffmpeg)
-          frame_dump_started = StartFrameDumpToFFMPEG(frame);
-        else
-          frame_dump_started = StartFrameDumpToImage(frame);
+        std::lock_guard<std::mutex> lk(m_screenshot_lock);
 
-        // Stop frame dumping if we fail to start.
-        if (!frame_dump_started)
-          Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+        if (DumpFrameToPNG(frame, m_screenshot_name))
+          OSD::AddMessage("Screenshot saved to " + m_screenshot_name);
+
+        // Reset settings
+        m_screenshot_name.clear();
+        m_screenshot_completed.Set();
       }
 
-      // If we failed to start frame dumping, don't write a frame.
-      if (frame_dump_started)
+      if (Config::Get(Config::MAIN_MOVIE_DUMP_FRAMES))
       {
-        if (dump_to_ffmpeg)
-          DumpFrameToFFMPEG(frame);
-        else
-          DumpFrameToImage(frame);
+        if (!frame_dump_started)
+        {
+          if (dump_to_ffmpeg)
+            frame_dump_started = StartFrameDumpToFFMPEG(frame);
+          else
+            frame_dump_started = StartFrameDumpToImage(frame);
+
+          // Stop frame dumping if we fail to start.
+          if (!frame_dump_started)
+            Config::SetCurrent(Config::MAIN_MOVIE_DUMP_FRAMES, false);
+        }
+
+        // If we failed to start frame dumping, don't write a frame.
+        if (frame_dump_started)
+        {
+          if (dump_to_ffmpeg)
+            DumpFrameToFFMPEG(frame);
+          else
+            DumpFrameToImage(frame);
+        }
       }
-    }
 
-    m_frame_dump_done.Set();
+      m_frame_dump_frames_done.fetch_add(1, std::memory_order_release);
+      m_frame_dump_done.Set();
+    }
   }
 
   if (frame_dump_started)
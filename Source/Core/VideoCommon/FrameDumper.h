@@ -3,6 +3,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "Common/CommonTypes.h"
 #include "Common/Event.h"
 #include "Common/Flag.h"
@@ -56,7 +65,16 @@ private:
   bool CheckFrameDumpReadbackTexture(u32 target_width, u32 target_height);
 
   // Asynchronously encodes the specified pointer of frame data to the frame dump.
-  void DumpFrameData(const u8* data, int w, int h, int stride);
+  void QueueFrameData(const u8* data, int w, int h, int stride);
+
+  // Called on the frame dumping thread to take the oldest queued frame.
+  std::optional<FrameData> PopFrameData();
+
+  // Unmaps and recycles the staging textures of frames the dumping thread has finished with.
+  void ReclaimFinishedFrames();
+
+  // Waits until at most max_frames frames are queued for encoding.
+  void WaitForQueuedFrames(size_t max_frames);
 
   // Ensures all encoded frames have been written to the output file.
   void FinishFrameData();
@@ -73,20 +91,27 @@ private:
   // Holds emulation state during the last swap when dumping.
   FrameState m_last_frame_state;
 
-  // Communication of frame between video and dump threads.
-  FrameData m_frame_dump_data;
+  // Communication of frames between video and dump threads.
+  std::mutex m_frame_dump_queue_lock;
+  std::deque<FrameData> m_frame_dump_queue;
+  std::atomic<u64> m_frame_dump_frames_done = 0;
 
   // Texture used for screenshot/frame dumping
   std::unique_ptr<AbstractTexture> m_frame_dump_render_texture;
   std::unique_ptr<AbstractFramebuffer> m_frame_dump_render_framebuffer;
 
-  // Double buffer:
+  // Staging ring. The readback texture receives the current frame, while the output textures
+  // stay mapped until the dump thread has encoded them, oldest first.
   std::unique_ptr<AbstractStagingTexture> m_frame_dump_readback_texture;
-  std::unique_ptr<AbstractStagingTexture> m_frame_dump_output_texture;
+  std::deque<std::unique_ptr<AbstractStagingTexture>> m_frame_dump_output_textures;
+  std::vector<std::unique_ptr<AbstractStagingTexture>> m_frame_dump_free_textures;
+  u64 m_frame_dump_frames_queued = 0;
   // Set when readback texture holds a frame that needs to be dumped.
   bool m_frame_dump_needs_flush = false;
-  // Set when thread is processing output texture.
-  bool m_frame_dump_frame_running = false;
+
+  // How often, and for how long, the video thread had to wait for the encoder to catch up.
+  u64 m_frame_dump_stall_count = 0;
+  std::chrono::steady_clock::duration m_frame_dump_stall_time{};
 
   // Used to generate screenshot names.
   u32 m_frame_dump_image_counter = 0;
@@ -3,6 +3,8 @@
 
 #include "VideoCommon/PerformanceMetrics.h"
 
+#include <algorithm>
+#include <bit>
 #include <mutex>
 
 #include <imgui.h>
@@ -24,6 +26,9 @@ void PerformanceMetrics::Reset()
   m_time_sleeping = DT::zero();
   m_real_times.fill(Clock::now());
   m_cpu_times.fill(Core::System::GetInstance().GetCoreTiming().GetCPUTimePoint(0));
+
+  std::lock_guard lock(m_gpu_sync_lock);
+  m_gpu_sync_stalls.fill({});
 }
 
 void PerformanceMetrics::CountFrame()
@@ -52,6 +57,26 @@ void PerformanceMetrics::CountPerformanceMarker(Core::System& system, s64 cycles
   m_time_index += 1;
 }
 
+void PerformanceMetrics::CountGPUSyncStall(Fifo::SyncGPUReason reason, DT stall)
+{
+  const u64 us = std::chrono::duration_cast<std::chrono::microseconds>(stall).count();
+  const size_t bucket =
+      std::min<size_t>(std::bit_width(us), GPUSyncStalls::BUCKET_COUNT - 1);
+
+  std::lock_guard lock(m_gpu_sync_lock);
+  GPUSyncStalls& stalls = m_gpu_sync_stalls[static_cast<size_t>(reason)];
+  stalls.count++;
+  stalls.total_time += stall;
+  stalls.histogram[bucket]++;
+}
+
+PerformanceMetrics::GPUSyncStalls
+PerformanceMetrics::GetGPUSyncStalls(Fifo::SyncGPUReason reason) const
+{
+  std::lock_guard lock(m_gpu_sync_lock);
+  return m_gpu_sync_stalls[static_cast<size_t>(reason)];
+}
+
 double PerformanceMetrics::GetFPS() const
 {
   return m_fps_counter.GetHzAvg();
@@ -4,9 +4,11 @@
 #pragma once
 
 #include <array>
+#include <mutex>
 #include <shared_mutex>
 
 #include "Common/CommonTypes.h"
+#include "VideoCommon/Fifo.h"
 #include "VideoCommon/PerformanceTracker.h"
 
 namespace Core
@@ -17,6 +19,18 @@ class System;
 class PerformanceMetrics
 {
 public:
+  // Time the CPU thread spent blocked waiting for the GPU thread, for a single SyncGPUReason.
+  struct GPUSyncStalls
+  {
+    static constexpr size_t BUCKET_COUNT = 16;
+
+    u64 count = 0;
+    DT total_time{};
+    // Bucket 0 counts stalls shorter than 1us, bucket i counts stalls of [2^(i-1), 2^i) us, and
+    // the last bucket also counts everything longer.
+    std::array<u64, BUCKET_COUNT> histogram{};
+  };
+
   PerformanceMetrics() = default;
   ~PerformanceMetrics() = default;
 
@@ -32,6 +46,7 @@ public:
 
   void CountThrottleSleep(DT sleep);
   void CountPerformanceMarker(Core::System& system, s64 cyclesLate);
+  void CountGPUSyncStall(Fifo::SyncGPUReason reason, DT stall);
 
   // Getter Functions
   double GetFPS() const;
@@ -41,6 +56,8 @@ public:
 
   double GetLastSpeedDenominator() const;
 
+  GPUSyncStalls GetGPUSyncStalls(Fifo::SyncGPUReason reason) const;
+
   // ImGui Functions
   void DrawImGuiStats(const float backbuffer_scale);
 
@@ -57,6 +74,9 @@ private:
   std::array<TimePoint, 256> m_real_times{};
   std::array<TimePoint, 256> m_cpu_times{};
   DT m_time_sleeping{};
+
+  mutable std::mutex m_gpu_sync_lock;
+  std::array<GPUSyncStalls, Fifo::NUM_SYNC_GPU_REASONS> m_gpu_sync_stalls{};
 };
 
 extern PerformanceMetrics g_perf_metrics;
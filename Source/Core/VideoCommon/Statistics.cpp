@@ -3,6 +3,7 @@
 
 #include "VideoCommon/Statistics.h"
 
+#include <array>
 #include <cstring>
 #include <utility>
 
@@ -13,6 +14,8 @@
 #include "Core/System.h"
 
 #include "VideoCommon/BPFunctions.h"
+#include "VideoCommon/Fifo.h"
+#include "VideoCommon/PerformanceMetrics.h"
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 #include "VideoCommon/VideoEvents.h"
@@ -112,9 +115,28 @@ void Statistics::Display() const
   draw_statistic("Vertex Loaders", "%d", num_vertex_loaders);
   draw_statistic("EFB peeks:", "%d", this_frame.num_efb_peeks);
   draw_statistic("EFB pokes:", "%d", this_frame.num_efb_pokes);
+  draw_statistic("Texture lookups:", "%d", this_frame.num_texture_cache_lookups);
+  draw_statistic("Texture overlap queries:", "%d/%d", this_frame.num_texture_cache_overlap_queries,
+                 this_frame.num_texture_cache_overlap_candidates);
+  draw_statistic("Textures invalidated:", "%d", this_frame.num_textures_invalidated);
   draw_statistic("Draw dones:", "%d", this_frame.num_draw_done);
   draw_statistic("Tokens:", "%d/%d", this_frame.num_token, this_frame.num_token_int);
 
+  // These are totals since the game was started, rather than per frame.
+  static constexpr std::array<const char*, Fifo::NUM_SYNC_GPU_REASONS> sync_gpu_reason_names = {
+      "GPU sync stalls (other):",      "GPU sync stalls (wraparound):",
+      "GPU sync stalls (EFB poke):",   "GPU sync stalls (perf query):",
+      "GPU sync stalls (bbox):",       "GPU sync stalls (swap):",
+      "GPU sync stalls (aux space):",  "GPU sync stalls (max distance):",
+  };
+  for (size_t i = 0; i < sync_gpu_reason_names.size(); ++i)
+  {
+    const auto stalls = g_perf_metrics.GetGPUSyncStalls(static_cast<Fifo::SyncGPUReason>(i));
+    draw_statistic(sync_gpu_reason_names[i], "%llu (%.1f ms)",
+                   static_cast<unsigned long long>(stalls.count),
+                   DT_ms(stalls.total_time).count());
+  }
+
   ImGui::Columns(1);
 
   ImGui::End();
@@ -76,6 +76,11 @@ struct Statistics
     int num_efb_peeks = 0;
     int num_efb_pokes = 0;
 
+    int num_texture_cache_lookups = 0;
+    int num_texture_cache_overlap_queries = 0;
+    int num_texture_cache_overlap_candidates = 0;
+    int num_textures_invalidated = 0;
+
     int num_draw_done = 0;
     int num_token = 0;
     int num_token_int = 0;
@@ -79,6 +79,76 @@ TCacheEntry::~TCacheEntry()
   g_texture_cache->ReleaseToPool(this);
 }
 
+void TexHashCache::Insert(u64 hash, const RcTcacheEntry& entry)
+{
+  Erase(entry.get());
+
+  if ((m_size + m_tombstones + 1) * 2 > m_slots.size())
+  {
+    size_t capacity = std::max<size_t>(m_slots.size(), 64);
+    while ((m_size + 1) * 4 > capacity)
+      capacity *= 2;
+    Rebuild(capacity);
+  }
+
+  const size_t mask = m_slots.size() - 1;
+  size_t i = hash & mask;
+  while (m_slots[i].entry)
+    i = (i + 1) & mask;
+
+  Slot& slot = m_slots[i];
+  if (slot.used)
+    m_tombstones--;
+  slot.hash = hash;
+  slot.entry = entry;
+  slot.used = true;
+  entry->textures_by_hash_slot = static_cast<u32>(i);
+  m_size++;
+}
+
+void TexHashCache::Erase(TCacheEntry* entry)
+{
+  if (entry->textures_by_hash_slot == TCacheEntry::NO_HASH_SLOT)
+    return;
+
+  Slot& slot = m_slots[entry->textures_by_hash_slot];
+  entry->textures_by_hash_slot = TCacheEntry::NO_HASH_SLOT;
+  slot.entry.reset();
+  m_size--;
+  m_tombstones++;
+}
+
+void TexHashCache::Clear()
+{
+  for (Slot& slot : m_slots)
+  {
+    if (slot.entry)
+      slot.entry->textures_by_hash_slot = TCacheEntry::NO_HASH_SLOT;
+  }
+  m_slots.clear();
+  m_size = 0;
+  m_tombstones = 0;
+}
+
+void TexHashCache::Rebuild(size_t capacity)
+{
+  std::vector<Slot> old_slots = std::exchange(m_slots, std::vector<Slot>(capacity));
+  m_tombstones = 0;
+
+  const size_t mask = capacity - 1;
+  for (Slot& old_slot : old_slots)
+  {
+    if (!old_slot.entry)
+      continue;
+
+    size_t i = old_slot.hash & mask;
+    while (m_slots[i].used)
+      i = (i + 1) & mask;
+    old_slot.entry->textures_by_hash_slot = static_cast<u32>(i);
+    m_slots[i] = std::move(old_slot);
+  }
+}
+
 void TextureCacheBase::CheckTempSize(size_t required_size)
 {
   if (required_size <= m_temp_size)
@@ -139,8 +209,9 @@ void TextureCacheBase::Invalidate()
 
   for (auto& bind : m_bound_textures)
     bind.reset();
-  m_textures_by_hash.clear();
+  m_textures_by_hash.Clear();
   m_textures_by_address.clear();
+  m_texture_range_index.Clear();
 
   m_texture_pool.clear();
 }
@@ -348,7 +419,7 @@ RcTcacheEntry TextureCacheBase::ApplyPaletteToEntry(RcTcacheEntry& entry, const
     g_gfx->EndUtilityDrawing();
   }
 
-  m_textures_by_address.emplace(decoded_entry->addr, decoded_entry);
+  AddToAddressCache(decoded_entry->addr, decoded_entry);
 
   return decoded_entry;
 }
@@ -394,7 +465,7 @@ RcTcacheEntry TextureCacheBase::ReinterpretEntry(const RcTcacheEntry& existing_e
   g_gfx->EndUtilityDrawing();
   reinterpreted_entry->texture->FinishedRendering();
 
-  m_textures_by_address.emplace(reinterpreted_entry->addr, reinterpreted_entry);
+  AddToAddressCache(reinterpreted_entry->addr, reinterpreted_entry);
 
   return reinterpreted_entry;
 }
@@ -618,14 +689,13 @@ void TextureCacheBase::DoSaveState(PointerWrap& p)
         textures_by_address_list.emplace_back(it.first, id);
       }
     }
-    for (const auto& it : m_textures_by_hash)
-    {
-      if (ShouldSaveEntry(it.second))
+    m_textures_by_hash.ForEach([&](u64 hash, const RcTcacheEntry& entry) {
+      if (ShouldSaveEntry(entry))
       {
-        const u32 id = AddCacheEntryToMap(it.second);
-        textures_by_hash_list.emplace_back(it.first, id);
+        const u32 id = AddCacheEntryToMap(entry);
+        textures_by_hash_list.emplace_back(hash, id);
       }
-    }
+    });
     for (u32 i = 0; i < m_bound_textures.size(); i++)
     {
       const auto& tentry = m_bound_textures[i];
@@ -717,7 +787,6 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
     auto tex = DeserializeTexture(p);
     auto entry =
         std::make_shared<TCacheEntry>(std::move(tex->texture), std::move(tex->framebuffer));
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
     entry->DoState(p);
     if (entry->texture && commit_state)
       id_map.emplace(i, entry);
@@ -748,7 +817,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      m_textures_by_address.emplace(addr, entry);
+      AddToAddressCache(addr, entry);
   }
 
   // Fill in hash map.
@@ -762,7 +831,7 @@ void TextureCacheBase::DoLoadState(PointerWrap& p)
 
     auto& entry = GetEntry(id);
     if (entry)
-      entry->textures_by_hash_iter = m_textures_by_hash.emplace(hash, entry);
+      m_textures_by_hash.Insert(hash, entry);
   }
 
   // Clear bound textures
@@ -790,6 +859,7 @@ void TextureCacheBase::OnFrameEnd()
   // rate and not waiting for vblank. Otherwise, we'd end up with a huge list of pending
   // copies.
   FlushEFBCopies();
+  TrimEFBCopyStagingTexturePool();
 
   Cleanup(g_presenter->FrameCount());
 }
@@ -849,10 +919,10 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
 
   u32 numBlocksX = (entry_to_update->native_width + block_width - 1) / block_width;
 
-  auto iter = FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes);
-  while (iter.first != iter.second)
+  for (const auto iter :
+       FindOverlappingTextures(entry_to_update->addr, entry_to_update->size_in_bytes))
   {
-    auto& entry = iter.first->second;
+    auto& entry = iter->second;
     if (entry != entry_to_update && entry->IsCopy() &&
         !entry->references.contains(entry_to_update.get()) &&
         entry->OverlapsMemoryRange(entry_to_update->addr, entry_to_update->size_in_bytes) &&
@@ -864,10 +934,7 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
         if (!IsCompatibleTextureFormat(entry_to_update->format.texfmt, entry->format.texfmt))
         {
           if (!CanReinterpretTextureOnGPU(entry_to_update->format.texfmt, entry->format.texfmt))
-          {
-            ++iter.first;
             continue;
-          }
 
           auto reinterpreted_entry = ReinterpretEntry(entry, entry_to_update->format.texfmt);
           if (reinterpreted_entry)
@@ -888,7 +955,6 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
           }
           else
           {
-            ++iter.first;
             continue;
           }
         }
@@ -950,7 +1016,6 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
             static_cast<u32>(dst_x + copy_width) > entry_to_update->GetWidth() ||
             static_cast<u32>(dst_y + copy_height) > entry_to_update->GetHeight())
         {
-          ++iter.first;
           continue;
         }
 
@@ -976,7 +1041,7 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
         {
           // Remove the temporary converted texture, it won't be used anywhere else
           // TODO: It would be nice to convert and copy in one step, but this code path isn't common
-          iter.first = InvalidateTexture(iter.first);
+          InvalidateTexture(iter);
           continue;
         }
         else
@@ -990,11 +1055,9 @@ RcTcacheEntry TextureCacheBase::DoPartialTextureUpdates(RcTcacheEntry& entry_to_
       else
       {
         // If the hash does not match, this EFB copy will not be used for anything, so remove it
-        iter.first = InvalidateTexture(iter.first);
-        continue;
+        InvalidateTexture(iter);
       }
     }
-    ++iter.first;
   }
 
   return entry_to_update;
@@ -1393,6 +1456,7 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
   //
   // For efb copies, the entry created in CopyRenderTargetToTexture always has to be used, or else
   // it was done in vain.
+  INCSTAT(g_stats.this_frame.num_texture_cache_lookups);
   auto iter_range = m_textures_by_address.equal_range(texture_info.GetRawAddress());
   TexAddrCache::iterator iter = iter_range.first;
   TexAddrCache::iterator oldest_entry = iter;
@@ -1541,25 +1605,27 @@ RcTcacheEntry TextureCacheBase::GetTexture(const int textureCacheSafetyColorSamp
       std::max(texture_info.GetTextureSize(), palette_size) <=
           (u32)textureCacheSafetyColorSampleSize * 8)
   {
-    auto hash_range = m_textures_by_hash.equal_range(full_hash);
-    TexHashCache::iterator hash_iter = hash_range.first;
-    while (hash_iter != hash_range.second)
-    {
-      RcTcacheEntry& entry = hash_iter->second;
+    RcTcacheEntry hash_match;
+    m_textures_by_hash.Find(full_hash, [&](const RcTcacheEntry& candidate) {
       // All parameters, except the address, need to match here
-      if (entry->format == full_format && entry->native_levels >= texture_info.GetLevelCount() &&
-          entry->native_width == texture_info.GetRawWidth() &&
-          entry->native_height == texture_info.GetRawHeight())
+      if (candidate->format != full_format ||
+          candidate->native_levels < texture_info.GetLevelCount() ||
+          candidate->native_width != texture_info.GetRawWidth() ||
+          candidate->native_height != texture_info.GetRawHeight())
       {
-        entry = DoPartialTextureUpdates(hash_iter->second, texture_info.GetTlutAddress(),
-                                        texture_info.GetTlutFormat());
-        if (entry)
-        {
-          entry->texture->FinishedRendering();
-          return entry;
-        }
+        return false;
       }
-      ++hash_iter;
+
+      // Partial updates may remove textures from the hash cache, so don't hold on to the slot.
+      RcTcacheEntry entry = candidate;
+      hash_match = DoPartialTextureUpdates(entry, texture_info.GetTlutAddress(),
+                                           texture_info.GetTlutFormat());
+      return hash_match != nullptr;
+    });
+    if (hash_match)
+    {
+      hash_match->texture->FinishedRendering();
+      return hash_match;
     }
   }
 
@@ -1825,14 +1891,6 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
     }
   }
 
-  const auto iter = m_textures_by_address.emplace(texture_info.GetRawAddress(), entry);
-  if (safety_color_sample_size == 0 ||
-      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
-          (u32)safety_color_sample_size * 8)
-  {
-    entry->textures_by_hash_iter = m_textures_by_hash.emplace(creation_info.full_hash, entry);
-  }
-
   const TextureAndTLUTFormat full_format(texture_info.GetTextureFormat(),
                                          texture_info.GetTlutFormat());
   entry->SetGeneralParameters(texture_info.GetRawAddress(), texture_info.GetTextureSize(),
@@ -1843,6 +1901,15 @@ RcTcacheEntry TextureCacheBase::CreateTextureEntry(
   entry->memory_stride = entry->BytesPerRow();
   entry->SetNotCopy();
 
+  // The range index needs the size of the entry, so only insert it once the parameters are set.
+  const auto iter = AddToAddressCache(texture_info.GetRawAddress(), entry);
+  if (safety_color_sample_size == 0 ||
+      std::max(texture_info.GetTextureSize(), creation_info.palette_size) <=
+          (u32)safety_color_sample_size * 8)
+  {
+    m_textures_by_hash.Insert(creation_info.full_hash, entry);
+  }
+
   INCSTAT(g_stats.num_textures_uploaded);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
 
@@ -1925,7 +1992,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
   entry->texture->FinishedRendering();
 
   // Insert into the texture cache so we can re-use it next frame, if needed.
-  m_textures_by_address.emplace(entry->addr, entry);
+  AddToAddressCache(entry->addr, entry);
   SETSTAT(g_stats.num_textures_alive, static_cast<int>(m_textures_by_address.size()));
   INCSTAT(g_stats.num_textures_uploaded);
 
@@ -1951,6 +2018,7 @@ RcTcacheEntry TextureCacheBase::GetXFBTexture(u32 address, u32 width, u32 height
 
 RcTcacheEntry TextureCacheBase::GetXFBFromCache(u32 address, u32 width, u32 height, u32 stride)
 {
+  INCSTAT(g_stats.this_frame.num_texture_cache_lookups);
   auto iter_range = m_textures_by_address.equal_range(address);
   TexAddrCache::iterator iter = iter_range.first;
 
@@ -1994,15 +2062,15 @@ void TextureCacheBase::StitchXFBCopy(RcTcacheEntry& stitched_entry)
   std::vector<TCacheEntry*> candidates;
   bool create_upscaled_copy = false;
 
-  auto iter = FindOverlappingTextures(stitched_entry->addr, stitched_entry->size_in_bytes);
-  while (iter.first != iter.second)
+  for (const auto iter :
+       FindOverlappingTextures(stitched_entry->addr, stitched_entry->size_in_bytes))
   {
     // Currently, this checks the stride of the VRAM copy against the VI request. Therefore, for
     // interlaced modes, VRAM copies won't be considered candidates. This is okay for now, because
     // our force progressive hack means that an XFB copy should always have a matching stride. If
     // the hack is disabled, XFB2RAM should also be enabled. Should we wish to implement interlaced
     // stitching in the future, this would require a shader which grabs every second line.
-    auto& entry = iter.first->second;
+    auto& entry = iter->second;
     if (entry != stitched_entry && entry->IsCopy() &&
         entry->OverlapsMemoryRange(stitched_entry->addr, stitched_entry->size_in_bytes) &&
         entry->memory_stride == stitched_entry->memory_stride)
@@ -2018,11 +2086,9 @@ void TextureCacheBase::StitchXFBCopy(RcTcacheEntry& stitched_entry)
       else
       {
         // If the hash does not match, this EFB copy will not be used for anything, so remove it
-        iter.first = InvalidateTexture(iter.first);
-        continue;
+        InvalidateTexture(iter);
       }
     }
-    ++iter.first;
   }
 
   if (candidates.empty())
@@ -2464,10 +2530,9 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   // as our efb copy are marked to check them for partial texture updates.
   // TODO: The logic to detect overlapping strided efb copies is not 100% accurate.
   bool strided_efb_copy = dstStride != bytes_per_row;
-  auto iter = FindOverlappingTextures(dstAddr, covered_range);
-  while (iter.first != iter.second)
+  for (const auto iter : FindOverlappingTextures(dstAddr, covered_range))
   {
-    RcTcacheEntry& overlapping_entry = iter.first->second;
+    RcTcacheEntry& overlapping_entry = iter->second;
 
     if (overlapping_entry->addr == dstAddr && overlapping_entry->is_xfb_copy)
     {
@@ -2489,7 +2554,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
       {
         // Pending EFB copies which are completely covered by this new copy can simply be tossed,
         // instead of having to flush them later on, since this copy will write over everything.
-        iter.first = InvalidateTexture(iter.first, true);
+        InvalidateTexture(iter, true);
         continue;
       }
 
@@ -2513,13 +2578,8 @@ void TextureCacheBase::CopyRenderTargetToTexture(
 
       // Do not load textures by hash, if they were at least partly overwritten by an efb copy.
       // In this case, comparing the hash is not enough to check, if two textures are identical.
-      if (overlapping_entry->textures_by_hash_iter != m_textures_by_hash.end())
-      {
-        m_textures_by_hash.erase(overlapping_entry->textures_by_hash_iter);
-        overlapping_entry->textures_by_hash_iter = m_textures_by_hash.end();
-      }
+      m_textures_by_hash.Erase(overlapping_entry.get());
     }
-    ++iter.first;
   }
 
   if (OpcodeDecoder::g_record_fifo_data)
@@ -2540,7 +2600,7 @@ void TextureCacheBase::CopyRenderTargetToTexture(
   {
     const u64 hash = entry->CalculateHash();
     entry->SetHashes(hash, hash);
-    m_textures_by_address.emplace(dstAddr, std::move(entry));
+    AddToAddressCache(dstAddr, std::move(entry));
   }
 }
 
@@ -2549,6 +2609,15 @@ void TextureCacheBase::FlushEFBCopies()
   if (m_pending_efb_copies.empty())
     return;
 
+  // Wait for the most recent copy first. On backends which track copies with fences, this submits
+  // all outstanding GPU work at once, which makes the flushes of the older copies no-ops. Waiting
+  // on the oldest copy first could leave the GPU idle until the newer copies are submitted.
+  for (auto it = m_pending_efb_copies.rbegin(); it != m_pending_efb_copies.rend(); ++it)
+  {
+    if ((*it)->pending_efb_copy)
+      (*it)->pending_efb_copy->Flush();
+  }
+
   for (auto& entry : m_pending_efb_copies)
     FlushEFBCopy(entry.get());
   m_pending_efb_copies.clear();
@@ -2596,8 +2665,7 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
   // See the comment above regarding Rogue Squadron 2.
   if (entry->is_xfb_copy)
   {
-    auto range = FindOverlappingTextures(entry->addr, covered_range);
-    for (auto iter = range.first; iter != range.second; ++iter)
+    for (const auto iter : FindOverlappingTextures(entry->addr, covered_range))
     {
       auto& overlapping_entry = iter->second;
       if (overlapping_entry->may_have_overlapping_textures && overlapping_entry->is_xfb_copy &&
@@ -2612,27 +2680,61 @@ void TextureCacheBase::FlushEFBCopy(TCacheEntry* entry)
 
 std::unique_ptr<AbstractStagingTexture> TextureCacheBase::GetEFBCopyStagingTexture()
 {
+  std::unique_ptr<AbstractStagingTexture> tex;
+
   // Pull off the back first to re-use the most frequently used textures.
   if (!m_efb_copy_staging_texture_pool.empty())
   {
-    auto ptr = std::move(m_efb_copy_staging_texture_pool.back());
+    tex = std::move(m_efb_copy_staging_texture_pool.back());
     m_efb_copy_staging_texture_pool.pop_back();
-    return ptr;
+  }
+  else
+  {
+    tex = g_gfx->CreateStagingTexture(StagingTextureType::Readback,
+                                      m_efb_encoding_texture->GetConfig());
+    if (!tex)
+    {
+      WARN_LOG_FMT(VIDEO, "Failed to create EFB copy staging texture");
+      return tex;
+    }
   }
 
-  std::unique_ptr<AbstractStagingTexture> tex = g_gfx->CreateStagingTexture(
-      StagingTextureType::Readback, m_efb_encoding_texture->GetConfig());
-  if (!tex)
-    WARN_LOG_FMT(VIDEO, "Failed to create EFB copy staging texture");
-
+  m_efb_copy_staging_textures_in_use++;
+  m_efb_copy_staging_textures_peak =
+      std::max(m_efb_copy_staging_textures_peak, m_efb_copy_staging_textures_in_use);
   return tex;
 }
 
 void TextureCacheBase::ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex)
 {
+  if (!tex)
+    return;
+
+  m_efb_copy_staging_textures_in_use--;
   m_efb_copy_staging_texture_pool.push_back(std::move(tex));
 }
 
+void TextureCacheBase::TrimEFBCopyStagingTexturePool()
+{
+  // This runs on every XFB copy, and games often alternate between frames with and without EFB
+  // copies. Trimming against the last frame alone would free and recreate the same textures over
+  // and over, so keep enough for the busiest of the recent frames.
+  m_efb_copy_staging_frame_peaks[m_efb_copy_staging_frame_peaks_pos] =
+      m_efb_copy_staging_textures_peak;
+  m_efb_copy_staging_frame_peaks_pos =
+      (m_efb_copy_staging_frame_peaks_pos + 1) % m_efb_copy_staging_frame_peaks.size();
+  const u32 textures_to_keep = *std::max_element(m_efb_copy_staging_frame_peaks.begin(),
+                                                 m_efb_copy_staging_frame_peaks.end());
+
+  // Textures at the front of the pool are the least recently used ones.
+  const size_t excess =
+      m_efb_copy_staging_texture_pool.size() -
+      std::min<size_t>(m_efb_copy_staging_texture_pool.size(), textures_to_keep);
+  m_efb_copy_staging_texture_pool.erase(m_efb_copy_staging_texture_pool.begin(),
+                                        m_efb_copy_staging_texture_pool.begin() + excess);
+  m_efb_copy_staging_textures_peak = m_efb_copy_staging_textures_in_use;
+}
+
 void TextureCacheBase::UninitializeEFBMemory(u8* dst, u32 stride, u32 bytes_per_row,
                                              u32 num_blocks_y)
 {
@@ -2697,7 +2799,6 @@ RcTcacheEntry TextureCacheBase::AllocateCacheEntry(const TextureConfig& config)
 
   auto cacheEntry =
       std::make_shared<TCacheEntry>(std::move(alloc->texture), std::move(alloc->framebuffer));
-  cacheEntry->textures_by_hash_iter = m_textures_by_hash.end();
   cacheEntry->id = m_last_entry_id++;
   return cacheEntry;
 }
@@ -2767,21 +2868,39 @@ TextureCacheBase::TexAddrCache::iterator TextureCacheBase::GetTexCacheIter(TCach
   return m_textures_by_address.end();
 }
 
-std::pair<TextureCacheBase::TexAddrCache::iterator, TextureCacheBase::TexAddrCache::iterator>
-TextureCacheBase::FindOverlappingTextures(u32 addr, u32 size_in_bytes)
+TextureCacheBase::TexAddrCache::iterator TextureCacheBase::AddToAddressCache(u32 addr,
+                                                                             RcTcacheEntry entry)
 {
-  // We index by the starting address only, so there is no way to query all textures
-  // which end after the given addr. But the GC textures have a limited size, so we
-  // look for all textures which have a start address bigger than addr minus the maximal
-  // texture size. But this yields false-positives which must be checked later on.
+  const u32 size_in_bytes = entry->size_in_bytes;
+  const auto iter = m_textures_by_address.emplace(addr, std::move(entry));
+  m_texture_range_index.Add(addr, size_in_bytes, iter);
+  return iter;
+}
+
+TextureCacheBase::OverlappingTextures TextureCacheBase::FindOverlappingTextures(u32 addr,
+                                                                               u32 size_in_bytes)
+{
+  INCSTAT(g_stats.this_frame.num_texture_cache_overlap_queries);
 
-  // 1024 x 1024 texel times 8 nibbles per texel
-  constexpr u32 max_texture_size = 1024 * 1024 * 4;
-  u32 lower_addr = addr > max_texture_size ? addr - max_texture_size : 0;
-  auto begin = m_textures_by_address.lower_bound(lower_addr);
-  auto end = m_textures_by_address.upper_bound(addr + size_in_bytes);
+  // Callers rely on seeing the textures in the same order a plain address map would return them.
+  std::vector<TexAddrCache::iterator> result;
+  if (!m_overlap_query_buffers.empty())
+  {
+    result = std::move(m_overlap_query_buffers.back());
+    m_overlap_query_buffers.pop_back();
+  }
+  m_texture_range_index.FindOverlapping(addr, size_in_bytes, result);
 
-  return std::make_pair(begin, end);
+  ADDSTAT(g_stats.this_frame.num_texture_cache_overlap_candidates,
+          static_cast<int>(result.size()));
+  return OverlappingTextures(m_overlap_query_buffers, std::move(result));
+}
+
+void TextureCacheBase::RemoveFromRangeIndex(TexAddrCache::iterator iter)
+{
+  const bool removed =
+      m_texture_range_index.Remove(iter->first, iter->second->size_in_bytes, iter);
+  ASSERT_MSG(VIDEO, removed, "Texture at {:#010x} is missing from range index", iter->first);
 }
 
 TextureCacheBase::TexAddrCache::iterator
@@ -2790,13 +2909,11 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   if (iter == m_textures_by_address.end())
     return m_textures_by_address.end();
 
+  INCSTAT(g_stats.this_frame.num_textures_invalidated);
+
   RcTcacheEntry& entry = iter->second;
 
-  if (entry->textures_by_hash_iter != m_textures_by_hash.end())
-  {
-    m_textures_by_hash.erase(entry->textures_by_hash_iter);
-    entry->textures_by_hash_iter = m_textures_by_hash.end();
-  }
+  m_textures_by_hash.Erase(entry.get());
 
   // If this is a pending EFB copy, we don't want to flush it here.
   // Why? Because let's say a game is rendering a bloom-type effect, using EFB copies to essentially
@@ -2828,6 +2945,7 @@ TextureCacheBase::InvalidateTexture(TexAddrCache::iterator iter, bool discard_pe
   }
   entry->invalidated = true;
 
+  RemoveFromRangeIndex(iter);
   return m_textures_by_address.erase(iter);
 }
 
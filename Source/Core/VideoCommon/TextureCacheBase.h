@@ -6,6 +6,7 @@
 #include <array>
 #include <filesystem>
 #include <fmt/format.h>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -27,6 +28,7 @@
 #include "VideoCommon/TextureConfig.h"
 #include "VideoCommon/TextureDecoder.h"
 #include "VideoCommon/TextureInfo.h"
+#include "VideoCommon/TextureRangeIndex.h"
 #include "VideoCommon/TextureUtils.h"
 #include "VideoCommon/VideoEvents.h"
 
@@ -119,6 +121,8 @@ struct fmt::formatter<EFBCopyParams>
 
 struct TCacheEntry
 {
+  static constexpr u32 NO_HASH_SLOT = std::numeric_limits<u32>::max();
+
   // common members
   std::unique_ptr<AbstractTexture> texture;
   std::unique_ptr<AbstractFramebuffer> framebuffer;
@@ -152,9 +156,9 @@ struct TCacheEntry
   // used to delete textures which haven't been used for TEXTURE_KILL_THRESHOLD frames
   int frameCount = FRAMECOUNT_INVALID;
 
-  // Keep an iterator to the entry in m_textures_by_hash, so it does not need to be searched when
+  // Keep the slot of the entry in m_textures_by_hash, so it does not need to be searched when
   // removing the cache entry
-  std::multimap<u64, std::shared_ptr<TCacheEntry>>::iterator textures_by_hash_iter;
+  u32 textures_by_hash_slot = NO_HASH_SLOT;
 
   // This is used to keep track of both:
   //   * efb copies used by this partially updated texture
@@ -241,6 +245,59 @@ struct TCacheEntry
 
 using RcTcacheEntry = std::shared_ptr<TCacheEntry>;
 
+// Open addressing hash table of texture cache entries, keyed by their hash. Each entry can only be
+// in the table once, and remembers its slot so that removing it doesn't require a search. Removed
+// slots stay behind as tombstones until the next insertion rebuilds the table, which means entries
+// may be removed while the entries for a hash are being visited.
+class TexHashCache
+{
+public:
+  void Insert(u64 hash, const RcTcacheEntry& entry);
+  void Erase(TCacheEntry* entry);
+  void Clear();
+
+  // Calls the visitor with each entry that has the given hash, until it returns true.
+  template <typename Visitor>
+  void Find(u64 hash, Visitor&& visitor) const
+  {
+    if (m_slots.empty())
+      return;
+
+    const size_t mask = m_slots.size() - 1;
+    for (size_t i = hash & mask; m_slots[i].used; i = (i + 1) & mask)
+    {
+      const Slot& slot = m_slots[i];
+      if (slot.entry && slot.hash == hash && visitor(slot.entry))
+        return;
+    }
+  }
+
+  template <typename Func>
+  void ForEach(Func&& func) const
+  {
+    for (const Slot& slot : m_slots)
+    {
+      if (slot.entry)
+        func(slot.hash, slot.entry);
+    }
+  }
+
+private:
+  struct Slot
+  {
+    u64 hash = 0;
+    RcTcacheEntry entry;
+    // Stays set after the entry is removed, so that lookups continue past this slot
+    bool used = false;
+  };
+
+  void Rebuild(size_t capacity);
+
+  std::vector<Slot> m_slots;
+  size_t m_size = 0;
+  size_t m_tombstones = 0;
+};
+
 class TextureCacheBase
 {
 public:
@@ -340,7 +397,6 @@ protected:
 
 private:
   using TexAddrCache = std::multimap<u32, RcTcacheEntry>;
-  using TexHashCache = std::multimap<u64, RcTcacheEntry>;
 
   using TexPool = std::unordered_multimap<TextureConfig, TexPoolEntry>;
 
@@ -375,10 +431,41 @@ private:
   TexPool::iterator FindMatchingTextureFromPool(const TextureConfig& config);
   TexAddrCache::iterator GetTexCacheIter(TCacheEntry* entry);
 
-  // Return all possible overlapping textures. As addr+size of the textures is not
-  // indexed, this may return false positives.
-  std::pair<TexAddrCache::iterator, TexAddrCache::iterator>
-  FindOverlappingTextures(u32 addr, u32 size_in_bytes);
+  // Adds the entry to m_textures_by_address and the range index. The size of the entry must not
+  // change while it is in the cache.
+  TexAddrCache::iterator AddToAddressCache(u32 addr, RcTcacheEntry entry);
+
+  // Result of FindOverlappingTextures. Hands its buffer back to the texture cache when it goes
+  // out of scope, so overlap queries don't allocate, even when they nest.
+  class OverlappingTextures
+  {
+  public:
+    OverlappingTextures(std::vector<std::vector<TexAddrCache::iterator>>& pool,
+                        std::vector<TexAddrCache::iterator> textures)
+        : m_pool(pool), m_textures(std::move(textures))
+    {
+    }
+    OverlappingTextures(const OverlappingTextures&) = delete;
+    OverlappingTextures& operator=(const OverlappingTextures&) = delete;
+    ~OverlappingTextures()
+    {
+      m_textures.clear();
+      m_pool.push_back(std::move(m_textures));
+    }
+
+    auto begin() const { return m_textures.begin(); }
+    auto end() const { return m_textures.end(); }
+
+  private:
+    std::vector<std::vector<TexAddrCache::iterator>>& m_pool;
+    std::vector<TexAddrCache::iterator> m_textures;
+  };
+
+  // Return all possible overlapping textures, sorted by address, and in the order they were added
+  // for textures at the same address. This may return false positives, but only textures which
+  // start less than their own size rounded up to a power of two before addr.
+  OverlappingTextures FindOverlappingTextures(u32 addr, u32 size_in_bytes);
+  void RemoveFromRangeIndex(TexAddrCache::iterator iter);
 
   // Removes and unlinks texture from texture cache and returns it to the pool
   TexAddrCache::iterator InvalidateTexture(TexAddrCache::iterator t_iter,
@@ -404,6 +491,9 @@ private:
   // Returns an EFB copy staging texture to the pool, so it can be re-used.
   void ReleaseEFBCopyStagingTexture(std::unique_ptr<AbstractStagingTexture> tex);
 
+  // Frees pooled EFB copy staging textures which weren't needed during the last few frames.
+  void TrimEFBCopyStagingTexturePool();
+
   bool CheckReadbackTexture(u32 width, u32 height, AbstractTextureFormat format);
   void DoSaveState(PointerWrap& p);
   void DoLoadState(PointerWrap& p);
@@ -416,6 +506,10 @@ private:
   // All textures in here will also be in m_textures_by_address
   TexHashCache m_textures_by_hash;
 
+  // Range index of m_textures_by_address, used to find overlapping textures.
+  TextureRangeIndex<TexAddrCache::iterator> m_texture_range_index;
+  std::vector<std::vector<TexAddrCache::iterator>> m_overlap_query_buffers;
+
   // m_bound_textures are actually active in the current draw
   // It's valid for textures to be in here after they've been invalidated
   std::array<RcTcacheEntry, 8> m_bound_textures{};
@@ -449,8 +543,16 @@ private:
   // Decoding texture used for GPU texture decoding.
   std::unique_ptr<AbstractTexture> m_decoding_texture;
 
-  // Pool of readback textures used for deferred EFB copies.
+  // Pool of readback textures used for deferred EFB copies. Textures are kept around between
+  // frames, but the pool is trimmed at the end of each frame to the most that were in use at
+  // once during the last EFB_COPY_STAGING_PEAK_FRAMES frames, so a single burst of copies
+  // doesn't hold on to the memory forever.
+  static constexpr size_t EFB_COPY_STAGING_PEAK_FRAMES = 60;
   std::vector<std::unique_ptr<AbstractStagingTexture>> m_efb_copy_staging_texture_pool;
+  u32 m_efb_copy_staging_textures_in_use = 0;
+  u32 m_efb_copy_staging_textures_peak = 0;
+  std::array<u32, EFB_COPY_STAGING_PEAK_FRAMES> m_efb_copy_staging_frame_peaks{};
+  size_t m_efb_copy_staging_frame_peaks_pos = 0;
 
   // List of pending EFB copies. It is important that the order is preserved for these,
   // so that overlapping textures are written to guest RAM in the order they are issued.
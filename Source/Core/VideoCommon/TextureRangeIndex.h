@@ -0,0 +1,108 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+// Finds cached textures that may overlap a range of guest memory. Textures are grouped by the
+// power of two their size rounds up to, so a query only has to look back from the start of the
+// range by the size of each group, rather than by the largest possible texture size.
+//
+// Results are in address order, and textures at the same address come out in the order they were
+// added, which is the order a std::multimap keyed by address would return them in.
+template <typename T>
+class TextureRangeIndex
+{
+public:
+  void Add(u32 addr, u32 size_in_bytes, T value)
+  {
+    m_size_classes[GetSizeClass(size_in_bytes)].emplace(addr, Entry{m_next_sequence++, value});
+  }
+
+  // Returns false if the value wasn't in the index.
+  bool Remove(u32 addr, u32 size_in_bytes, const T& value)
+  {
+    auto& size_class = m_size_classes[GetSizeClass(size_in_bytes)];
+    const auto range = size_class.equal_range(addr);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+      if (iter->second.value == value)
+      {
+        size_class.erase(iter);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Clear()
+  {
+    for (auto& size_class : m_size_classes)
+      size_class.clear();
+  }
+
+  // Appends every value whose texture may overlap [addr, addr + size_in_bytes) to result. This
+  // still yields false-positives which must be checked later on.
+  void FindOverlapping(u32 addr, u32 size_in_bytes, std::vector<T>& result) const
+  {
+    // Merge the matching range of each size class, which are already sorted by address and then
+    // by insertion order.
+    std::array<std::pair<ConstIterator, ConstIterator>, NUM_SIZE_CLASSES> cursors;
+    size_t num_cursors = 0;
+    for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i)
+    {
+      const auto& size_class = m_size_classes[i];
+      if (size_class.empty())
+        continue;
+
+      const u64 max_size = u64{1} << i;
+      const u32 lower_addr = addr > max_size ? static_cast<u32>(addr - max_size) : 0;
+      const auto begin = size_class.lower_bound(lower_addr);
+      const auto end = size_class.upper_bound(addr + size_in_bytes);
+      if (begin != end)
+        cursors[num_cursors++] = {begin, end};
+    }
+
+    while (num_cursors != 0)
+    {
+      size_t next = 0;
+      for (size_t i = 1; i < num_cursors; ++i)
+      {
+        const auto& a = *cursors[i].first;
+        const auto& b = *cursors[next].first;
+        if (a.first < b.first || (a.first == b.first && a.second.sequence < b.second.sequence))
+          next = i;
+      }
+
+      result.push_back(cursors[next].first->second.value);
+      if (++cursors[next].first == cursors[next].second)
+        cursors[next] = cursors[--num_cursors];
+    }
+  }
+
+private:
+  static constexpr size_t NUM_SIZE_CLASSES = 33;
+
+  struct Entry
+  {
+    // Breaks ties between textures at the same address.
+    u64 sequence;
+    T value;
+  };
+  using ConstIterator = typename std::multimap<u32, Entry>::const_iterator;
+
+  static size_t GetSizeClass(u32 size_in_bytes)
+  {
+    return size_in_bytes <= 1 ? 0 : std::bit_width(size_in_bytes - 1);
+  }
+
+  std::array<std::multimap<u32, Entry>, NUM_SIZE_CLASSES> m_size_classes;
+  u64 m_next_sequence = 0;
+};
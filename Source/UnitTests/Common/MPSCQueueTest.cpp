@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/MPSCQueue.h"
+
+TEST(MPSCQueue, Simple)
+{
+  Common::MPSCQueue<u32> q;
+
+  EXPECT_TRUE(q.Empty());
+
+  q.Push(1);
+  EXPECT_FALSE(q.Empty());
+  EXPECT_EQ(1u, q.Front());
+
+  u32 v;
+  EXPECT_TRUE(q.Pop(v));
+  EXPECT_EQ(1u, v);
+  EXPECT_TRUE(q.Empty());
+  EXPECT_FALSE(q.Pop(v));
+
+  // Test the FIFO order.
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    EXPECT_EQ(i, q.Front());
+    q.Pop();
+  }
+  EXPECT_TRUE(q.Empty());
+
+  for (u32 i = 0; i < 1000; ++i)
+    q.Push(i);
+  EXPECT_FALSE(q.Empty());
+  q.Clear();
+  EXPECT_TRUE(q.Empty());
+}
+
+TEST(MPSCQueue, MultiThreaded)
+{
+  constexpr u32 PRODUCER_COUNT = 4;
+  constexpr u32 ITEM_COUNT = 100000;
+
+  Common::MPSCQueue<u32> q;
+
+  std::vector<std::thread> producers;
+  for (u32 producer = 0; producer < PRODUCER_COUNT; ++producer)
+  {
+    producers.emplace_back([&q, producer]() {
+      for (u32 i = 0; i < ITEM_COUNT; ++i)
+        q.Push(producer * ITEM_COUNT + i);
+    });
+  }
+
+  // Elements from a single producer must stay in order.
+  std::array<u32, PRODUCER_COUNT> next{};
+  for (u32 i = 0; i < PRODUCER_COUNT * ITEM_COUNT; ++i)
+  {
+    u32 v;
+    while (!q.Pop(v))
+      ;
+    const u32 producer = v / ITEM_COUNT;
+    ASSERT_LT(producer, PRODUCER_COUNT);
+    EXPECT_EQ(next[producer]++, v % ITEM_COUNT);
+  }
+  EXPECT_TRUE(q.Empty());
+
+  for (std::thread& producer : producers)
+    producer.join();
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+// Wii AX processes 96 samples per frame. Include a few counts that aren't multiples of the vector
+// width so that the scalar tail of the vectorized functions is covered as well.
+constexpr std::array<u32, 8> COUNTS = {0, 1, 7, 8, 9, 32, 95, 96};
+constexpr u32 MAX_COUNT = 96;
+
+// Values that are likely to hit the saturation and sign handling edge cases.
+constexpr std::array<u16, 8> EDGE_VALUES = {0x0000, 0x0001, 0x7FFF, 0x8000,
+                                            0x8001, 0xFFFF, 0x4000, 0xC000};
+
+std::array<s16, MAX_COUNT> RandomSamples(std::mt19937& rng)
+{
+  std::uniform_int_distribution<int> dist(-0x8000, 0x7FFF);
+  std::uniform_int_distribution<size_t> edge_dist(0, EDGE_VALUES.size() - 1);
+  std::array<s16, MAX_COUNT> samples;
+  for (size_t i = 0; i < samples.size(); ++i)
+  {
+    samples[i] = static_cast<s16>(i % 5 == 0 ? EDGE_VALUES[edge_dist(rng)] : dist(rng));
+  }
+  return samples;
+}
+}  // namespace
+
+TEST(AXMix, MixAddMatchesScalar)
+{
+  std::mt19937 rng(0x4158);
+  std::uniform_int_distribution<int> u16_dist(0, 0xFFFF);
+  std::uniform_int_distribution<int> out_dist(-0x100000, 0x100000);
+
+  for (int iteration = 0; iteration < 200; ++iteration)
+  {
+    for (u32 count : COUNTS)
+    {
+      const std::array<s16, MAX_COUNT> input = RandomSamples(rng);
+      const u16 start_volume = static_cast<u16>(
+          iteration < int(EDGE_VALUES.size()) ? EDGE_VALUES[iteration] : u16_dist(rng));
+      const u16 volume_delta = static_cast<u16>(iteration % 3 == 0 ? 0 : u16_dist(rng));
+
+      std::array<int, MAX_COUNT> expected_out;
+      for (int& value : expected_out)
+        value = out_dist(rng);
+      std::array<int, MAX_COUNT> actual_out = expected_out;
+
+      u16 expected_volume = start_volume;
+      u16 actual_volume = start_volume;
+      s16 expected_dpop = 0x1234;
+      s16 actual_dpop = 0x1234;
+
+      MixAddSamplesScalar(expected_out.data(), input.data(), count, &expected_volume,
+                          volume_delta, &expected_dpop);
+      MixAddSamples(actual_out.data(), input.data(), count, &actual_volume, volume_delta,
+                    &actual_dpop);
+
+      EXPECT_EQ(expected_out, actual_out);
+      EXPECT_EQ(expected_volume, actual_volume);
+      EXPECT_EQ(expected_dpop, actual_dpop);
+    }
+  }
+}
+
+TEST(AXMix, VolumeEnvelopeMatchesScalar)
+{
+  std::mt19937 rng(0x5856);
+  std::uniform_int_distribution<int> u16_dist(0, 0xFFFF);
+
+  for (bool signed_volume : {true, false})
+  {
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+      for (u32 count : COUNTS)
+      {
+        std::array<s16, MAX_COUNT> expected = RandomSamples(rng);
+        std::array<s16, MAX_COUNT> actual = expected;
+        const u16 start_volume = static_cast<u16>(
+            iteration < int(EDGE_VALUES.size()) ? EDGE_VALUES[iteration] : u16_dist(rng));
+        const u16 volume_delta = static_cast<u16>(iteration % 3 == 0 ? 0 : u16_dist(rng));
+
+        u16 expected_volume = start_volume;
+        u16 actual_volume = start_volume;
+
+        ApplyVolumeEnvelopeScalar(expected.data(), count, &expected_volume, volume_delta,
+                                  signed_volume);
+        ApplyVolumeEnvelope(actual.data(), count, &actual_volume, volume_delta, signed_volume);
+
+        EXPECT_EQ(expected, actual);
+        EXPECT_EQ(expected_volume, actual_volume);
+      }
+    }
+  }
+}
+
+TEST(AXMix, MixAddSaturates)
+{
+  const std::array<s16, 2> input = {-0x8000, 0x7FFF};
+  std::array<int, 2> out = {10, -10};
+  u16 volume = 0xFFFF;
+  s16 dpop = 0;
+
+  MixAddSamples(out.data(), input.data(), 2, &volume, 0, &dpop);
+
+  EXPECT_EQ(out[0], 10 - 0x8000);
+  EXPECT_EQ(out[1], -10 + 0x7FFF);
+  EXPECT_EQ(dpop, 0x7FFF);
+  EXPECT_EQ(volume, 0xFFFF);
+}
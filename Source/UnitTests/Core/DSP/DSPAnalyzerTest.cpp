@@ -0,0 +1,108 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/DSP/DSPAnalyzer.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPTables.h"
+
+using namespace DSP;
+
+namespace
+{
+// Analyzes a piece of code placed at the start of IRAM.
+class DSPAnalyzerTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    InitInstructionTable();
+    m_core.DSPState().iram = m_iram.data();
+    m_core.DSPState().irom = m_irom.data();
+  }
+
+  void TearDown() override
+  {
+    m_core.DSPState().iram = nullptr;
+    m_core.DSPState().irom = nullptr;
+  }
+
+  bool IsIdleSkip(std::initializer_list<u16> code, u16 address = 0)
+  {
+    m_iram.fill(0x0021);  // HALT
+    std::copy(code.begin(), code.end(), m_iram.begin());
+    m_analyzer.Analyze(m_core.DSPState());
+    return m_analyzer.IsIdleSkip(address);
+  }
+
+  DSPCore m_core;
+  Analyzer m_analyzer;
+  std::array<u16, DSP_IRAM_SIZE> m_iram{};
+  std::array<u16, DSP_IROM_SIZE> m_irom{};  // NOP
+};
+}  // namespace
+
+TEST_F(DSPAnalyzerTest, MailboxPollingLoops)
+{
+  // LR $ac0.m, @CMBH
+  // ANDCF $ac0.m, #0x8000
+  // JLNZ 0x0000
+  EXPECT_TRUE(IsIdleSkip({0x00de, 0xfffe, 0x02c0, 0x8000, 0x029c, 0x0000}));
+
+  // LRS $ac0.m, @DMBH
+  // ANDF $ac0.m, #0x8000
+  // JLZ 0x0000
+  EXPECT_TRUE(IsIdleSkip({0x26fc, 0x02a0, 0x8000, 0x029d, 0x0000}));
+
+  // LRS $ac0.m, @CMBH
+  // TST $ac0
+  // JGE 0x0000
+  EXPECT_TRUE(IsIdleSkip({0x26fe, 0xb100, 0x0290, 0x0000}));
+
+  // A loop may also start in the middle of the ucode.
+  // NOP
+  // LRS $ac0.m, @CMBH
+  // TST $ac0
+  // JGE 0x0001
+  EXPECT_TRUE(IsIdleSkip({0x0000, 0x26fe, 0xb100, 0x0290, 0x0001}, 0x0001));
+}
+
+TEST_F(DSPAnalyzerTest, NotMailboxPollingLoops)
+{
+  // Reads the low half of the mailbox, which the CPU writes last.
+  // LRS $ac0.m, @CMBL
+  // TST $ac0
+  // JGE 0x0000
+  EXPECT_FALSE(IsIdleSkip({0x26ff, 0xb100, 0x0290, 0x0000}));
+
+  // Loads into a stack register, which pushes a value every iteration.
+  // LR $st0, @CMBH
+  // ANDCF $ac0.m, #0x8000
+  // JLNZ 0x0000
+  EXPECT_FALSE(IsIdleSkip({0x00cc, 0xfffe, 0x02c0, 0x8000, 0x029c, 0x0000}));
+
+  // Changes state on every iteration.
+  // LRS $ac0.m, @CMBH
+  // DAR $ar0
+  // TST $ac0
+  // JGE 0x0000
+  EXPECT_FALSE(IsIdleSkip({0x26fe, 0x0004, 0xb100, 0x0290, 0x0000}));
+
+  // Jumps somewhere other than the mailbox read.
+  // LRS $ac0.m, @CMBH
+  // TST $ac0
+  // JGE 0x0010
+  EXPECT_FALSE(IsIdleSkip({0x26fe, 0xb100, 0x0290, 0x0010}));
+
+  // Too many tests in the loop body.
+  // LRS $ac0.m, @CMBH
+  // TST $ac0 (x5)
+  // JGE 0x0000
+  EXPECT_FALSE(IsIdleSkip({0x26fe, 0xb100, 0xb100, 0xb100, 0xb100, 0xb100, 0x0290, 0x0000}));
+}
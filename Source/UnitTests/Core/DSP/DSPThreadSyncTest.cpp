@@ -0,0 +1,105 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPLLE/DSPThreadSync.h"
+
+using namespace DSP::LLE;
+
+namespace
+{
+// Runs a DSP thread that just counts the cycles it was handed.
+class DSPThreadSyncTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_sync.Start();
+    m_dsp_thread = std::thread([this] {
+      m_sync.RunThread([this](int cycles) { m_cycles_run += static_cast<u64>(cycles); });
+    });
+  }
+
+  void TearDown() override
+  {
+    m_sync.Stop();
+    m_dsp_thread.join();
+  }
+
+  DSPThreadSync m_sync;
+  std::thread m_dsp_thread;
+  std::atomic<u64> m_cycles_run = 0;
+};
+}  // namespace
+
+// A hang in any of these tests shows up as a test timeout.
+
+TEST_F(DSPThreadSyncTest, UnlockWhileIdle)
+{
+  for (int i = 0; i < 10000; ++i)
+  {
+    m_sync.Lock();
+    m_sync.Unlock();
+  }
+  EXPECT_EQ(m_cycles_run, 0u);
+}
+
+TEST_F(DSPThreadSyncTest, UnlockRunsCyclesQueuedWhileLocked)
+{
+  u64 cycles_queued = 0;
+  for (int i = 0; i < 10000; ++i)
+  {
+    m_sync.Lock();
+    m_sync.QueueCycles(100, UINT32_MAX);
+    cycles_queued += 100;
+    m_sync.Unlock();
+    EXPECT_EQ(m_cycles_run, cycles_queued);
+  }
+}
+
+TEST_F(DSPThreadSyncTest, PauseAndUnpauseUnderLoad)
+{
+  u64 cycles_queued = 0;
+  for (int i = 0; i < 100000; ++i)
+  {
+    m_sync.QueueCycles(100, 500);
+    cycles_queued += 100;
+
+    if (i % 3 == 0)
+    {
+      m_sync.Lock();
+      m_sync.Unlock();
+    }
+    if (i % 7 == 0)
+      m_sync.WaitForDSPThread(0);
+  }
+
+  m_sync.WaitForDSPThread(0);
+  EXPECT_EQ(m_cycles_run, cycles_queued);
+}
+
+// Control register and mailbox accesses wait for the DSP thread with no slack, so the CPU must see
+// every cycle it handed over, even while the DSP is allowed to lag far behind.
+TEST_F(DSPThreadSyncTest, WaitWithoutSlackRunsAllQueuedCycles)
+{
+  u64 cycles_queued = 0;
+  for (int i = 0; i < 10000; ++i)
+  {
+    m_sync.QueueCycles(100, UINT32_MAX);
+    cycles_queued += 100;
+
+    if (i % 10 == 0)
+    {
+      m_sync.WaitForDSPThread(0);
+      EXPECT_EQ(m_cycles_run, cycles_queued);
+    }
+  }
+
+  m_sync.WaitForDSPThread(0);
+  EXPECT_EQ(m_cycles_run, cycles_queued);
+}
@@ -0,0 +1,76 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Core/HW/GPFifo.h"
+
+using GPFifo::GATHER_PIPE_SIZE;
+using GPFifo::GetContiguousBurstCount;
+
+namespace
+{
+constexpr u32 FIFO_BASE = 0x00100000;
+constexpr u32 FIFO_BURSTS = 8;
+// The end address is the start of the last burst, like the PI FIFO end register.
+constexpr u32 FIFO_END = FIFO_BASE + (FIFO_BURSTS - 1) * GATHER_PIPE_SIZE;
+
+u32 AdvanceWritePointer(u32 write_pointer)
+{
+  return write_pointer == FIFO_END ? FIFO_BASE : write_pointer + GATHER_PIPE_SIZE;
+}
+}  // namespace
+
+TEST(GPFifo, ContiguousBurstsStopAtEnd)
+{
+  EXPECT_EQ(GetContiguousBurstCount(FIFO_BASE, FIFO_END, 3), 3u);
+  EXPECT_EQ(GetContiguousBurstCount(FIFO_BASE, FIFO_END, 20), FIFO_BURSTS);
+  EXPECT_EQ(GetContiguousBurstCount(FIFO_END - GATHER_PIPE_SIZE, FIFO_END, 20), 2u);
+  EXPECT_EQ(GetContiguousBurstCount(FIFO_END, FIFO_END, 20), 1u);
+  EXPECT_EQ(GetContiguousBurstCount(FIFO_BASE, FIFO_END, 0), 0u);
+}
+
+TEST(GPFifo, WritePointerPastEndCopiesSingleBurst)
+{
+  EXPECT_EQ(GetContiguousBurstCount(FIFO_END + GATHER_PIPE_SIZE, FIFO_END, 20), 1u);
+  EXPECT_EQ(GetContiguousBurstCount(FIFO_END + GATHER_PIPE_SIZE, FIFO_END, 0), 0u);
+}
+
+// Every burst has to land at the same address as when the bursts are written one at a time, no
+// matter where in the FIFO the write pointer starts and how many bursts wrap around.
+TEST(GPFifo, BatchedBurstsWrapAroundLikeSingleBursts)
+{
+  for (u32 start = 0; start < FIFO_BURSTS; ++start)
+  {
+    for (u32 pending = 1; pending <= 3 * FIFO_BURSTS; ++pending)
+    {
+      std::vector<u32> expected;
+      u32 write_pointer = FIFO_BASE + start * GATHER_PIPE_SIZE;
+      for (u32 i = 0; i < pending; ++i)
+      {
+        expected.push_back(write_pointer);
+        write_pointer = AdvanceWritePointer(write_pointer);
+      }
+
+      std::vector<u32> actual;
+      write_pointer = FIFO_BASE + start * GATHER_PIPE_SIZE;
+      u32 remaining = pending;
+      while (remaining != 0)
+      {
+        const u32 bursts = GetContiguousBurstCount(write_pointer, FIFO_END, remaining);
+        ASSERT_NE(bursts, 0u);
+        for (u32 i = 0; i < bursts; ++i)
+          actual.push_back(write_pointer + i * GATHER_PIPE_SIZE);
+
+        for (u32 i = 0; i < bursts; ++i)
+          write_pointer = AdvanceWritePointer(write_pointer);
+        remaining -= bursts;
+      }
+
+      EXPECT_EQ(actual, expected) << "start " << start << ", pending " << pending;
+    }
+  }
+}
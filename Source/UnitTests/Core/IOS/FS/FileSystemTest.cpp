@@ -468,3 +468,26 @@ TEST_F(FileSystemTest, CreateFullPath)
   EXPECT_EQ(m_fs->CreateFullPath(Uid{0x1000}, Gid{1}, "/shared2/wc24/mbox/Readme.txt", 0, modes),
             ResultCode::Success);
 }
+
+// FST changes are journaled rather than written out immediately. Another instance must still
+// see them, as if Dolphin had been closed without flushing the FST.
+TEST_F(FileSystemTest, JournaledFstChanges)
+{
+  ASSERT_EQ(m_fs->CreateDirectory(Uid{0}, Gid{0}, "/tmp/j", 0, modes), ResultCode::Success);
+  const std::array<std::string, 3> file_names{{"b", "c", "a"}};
+  for (const auto& name : file_names)
+    ASSERT_EQ(m_fs->CreateFile(Uid{0}, Gid{0}, "/tmp/j/" + name, 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->SetMetadata(0, "/tmp/j/c", 123, 456, 0, modes), ResultCode::Success);
+  ASSERT_EQ(m_fs->Rename(Uid{0}, Gid{0}, "/tmp/j/b", "/tmp/b"), ResultCode::Success);
+
+  const auto fs = MakeFileSystem(Location::Session);
+
+  const Result<std::vector<std::string>> result = fs->ReadDirectory(Uid{0}, Gid{0}, "/tmp/j");
+  ASSERT_TRUE(result.Succeeded());
+  EXPECT_EQ(*result, (std::vector<std::string>{"a", "c"}));
+
+  const Result<Metadata> metadata = fs->GetMetadata(Uid{0}, Gid{0}, "/tmp/j/c");
+  ASSERT_TRUE(metadata.Succeeded());
+  EXPECT_EQ(metadata->uid, 123u);
+  EXPECT_EQ(metadata->gid, 456u);
+}
@@ -138,3 +138,76 @@ TEST_F(MappingTest, ReadWriteComplex)
   EXPECT_TRUE(read_called);
   EXPECT_TRUE(write_called);
 }
+
+namespace
+{
+template <typename T>
+struct IsDirectReadVisitor : public MMIO::ReadHandlingMethodVisitor<T>
+{
+  void VisitConstant(T) override {}
+  void VisitDirect(const T*, u32) override { is_direct = true; }
+  void VisitComplex(const std::function<T(Core::System&, u32)>*) override {}
+
+  bool is_direct = false;
+};
+
+template <typename T>
+struct IsDirectWriteVisitor : public MMIO::WriteHandlingMethodVisitor<T>
+{
+  void VisitNop() override {}
+  void VisitDirect(T*, u32) override { is_direct = true; }
+  void VisitComplex(const std::function<void(Core::System&, u32, T)>*) override {}
+
+  bool is_direct = false;
+};
+}  // namespace
+
+TEST_F(MappingTest, SizeConvertersOfDirectHalves)
+{
+  u32 target = 0x12345678;
+
+  m_mapping->Register(0x0C001000, MMIO::DirectRead<u16>(MMIO::Utils::HighPart(&target)),
+                      MMIO::DirectWrite<u16>(MMIO::Utils::HighPart(&target)));
+  m_mapping->Register(0x0C001002, MMIO::DirectRead<u16>(MMIO::Utils::LowPart(&target), 0xFF0F),
+                      MMIO::DirectWrite<u16>(MMIO::Utils::LowPart(&target)));
+  m_mapping->Register(0x0C001000, MMIO::ReadToSmaller<u32>(m_mapping.get(), 0x0C001000, 0x0C001002),
+                      MMIO::WriteToSmaller<u32>(m_mapping.get(), 0x0C001000, 0x0C001002));
+  m_mapping->RegisterRead(0x0C001000, MMIO::ReadToLarger<u8>(m_mapping.get(), 0x0C001000, 8));
+  m_mapping->RegisterRead(0x0C001001, MMIO::ReadToLarger<u8>(m_mapping.get(), 0x0C001000, 0));
+
+  // Both halves are backed by the same u32, so the converters should have become Direct accesses.
+  IsDirectReadVisitor<u32> read_visitor;
+  m_mapping->GetHandlerForRead<u32>(0x0C001000).Visit(read_visitor);
+  EXPECT_TRUE(read_visitor.is_direct);
+  IsDirectWriteVisitor<u32> write_visitor;
+  m_mapping->GetHandlerForWrite<u32>(0x0C001000).Visit(write_visitor);
+  EXPECT_TRUE(write_visitor.is_direct);
+
+  EXPECT_EQ(0x12345608u, m_mapping->Read<u32>(*m_system, 0x0C001000));
+  EXPECT_EQ(0x12, m_mapping->Read<u8>(*m_system, 0x0C001000));
+  EXPECT_EQ(0x34, m_mapping->Read<u8>(*m_system, 0x0C001001));
+
+  m_mapping->Write<u32>(*m_system, 0x0C001000, 0xCAFEBABE);
+  EXPECT_EQ(0xCAFEBABEu, target);
+  EXPECT_EQ(0xCAFEBA0Eu, m_mapping->Read<u32>(*m_system, 0x0C001000));
+}
+
+TEST_F(MappingTest, SizeConvertersOfComplexHandlers)
+{
+  u16 high = 0;
+  u16 low = 0;
+
+  m_mapping->Register(0x0C001000, MMIO::ComplexRead<u16>([](Core::System&, u32) { return 0xABCD; }),
+                      MMIO::ComplexWrite<u16>([&high](Core::System&, u32, u16 val) {
+                        high = val;
+                      }));
+  m_mapping->Register(0x0C001002, MMIO::Constant<u16>(0x1234),
+                      MMIO::DirectWrite<u16>(&low));
+  m_mapping->Register(0x0C001000, MMIO::ReadToSmaller<u32>(m_mapping.get(), 0x0C001000, 0x0C001002),
+                      MMIO::WriteToSmaller<u32>(m_mapping.get(), 0x0C001000, 0x0C001002));
+
+  EXPECT_EQ(0xABCD1234u, m_mapping->Read<u32>(*m_system, 0x0C001000));
+  m_mapping->Write<u32>(*m_system, 0x0C001000, 0x11223344);
+  EXPECT_EQ(0x1122, high);
+  EXPECT_EQ(0x3344, low);
+}
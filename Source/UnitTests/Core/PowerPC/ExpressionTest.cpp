@@ -0,0 +1,130 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "Common/CommonTypes.h"
+#include "Core/PowerPC/Expression.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "Core/System.h"
+
+namespace
+{
+class ExpressionTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    auto& ppc_state = m_system.GetPPCState();
+    ppc_state.gpr[3] = 5;
+    ppc_state.gpr[4] = 0xFFFFFFFF;
+    ppc_state.ps[1].SetPS0(std::numeric_limits<double>::quiet_NaN());
+    ppc_state.ps[2].SetPS0(-0.0);
+    ppc_state.ps[3].SetPS0(2.75);
+    ppc_state.ps[4].SetPS0(-2.75);
+    ppc_state.ps[5].SetPS0(std::numeric_limits<double>::infinity());
+    ppc_state.pc = 0x80003100;
+    ppc_state.msr.Hex = 0x00002032;
+    ppc_state.spr[SPR_LR] = 0x80004000;
+  }
+
+  // The compiled program and the interpreter have to agree down to the sign of zero.
+  void ExpectSameResult(std::string_view text, bool expect_compiled = true)
+  {
+    SCOPED_TRACE(text);
+    const std::optional<Expression> expression = Expression::TryParse(text);
+    ASSERT_TRUE(expression.has_value());
+    ASSERT_EQ(expression->IsCompiled(), expect_compiled);
+
+    const double compiled = expression->Evaluate(m_system);
+    const double interpreted = expression->EvaluateInterpreted(m_system);
+    if (std::isnan(interpreted))
+    {
+      EXPECT_TRUE(std::isnan(compiled)) << compiled;
+    }
+    else
+    {
+      EXPECT_EQ(std::bit_cast<u64>(compiled), std::bit_cast<u64>(interpreted))
+          << compiled << " != " << interpreted;
+    }
+  }
+
+  Core::System& m_system = Core::System::GetInstance();
+};
+
+// Builds 1+(1+(...)), which needs one stack slot per level.
+std::string NestedSum(int depth)
+{
+  std::string text;
+  for (int i = 0; i < depth; ++i)
+    text += "1+(";
+  text += "1";
+  text.append(depth, ')');
+  return text;
+}
+}  // namespace
+
+TEST_F(ExpressionTest, MatchesInterpreter)
+{
+  static constexpr std::string_view EXPRESSIONS[] = {
+      // Arithmetic and registers
+      "r3 + r4 * 2",
+      "r3 / 0",
+      "-r3 ** 2",
+      "f3 % 1",
+      "pc + msr - lr",
+      "unknown + 1",
+      "(r3, f3)",
+      // Comparisons, including NaN
+      "r3 < f3",
+      "f1 == f1",
+      "f1 != f1",
+      "f1 < 1",
+      "f2 == 0",
+      // Logical operators with NaN and negative zero
+      "f1 && 1",
+      "1 && f1",
+      "f1 && 0",
+      "0 && f1",
+      "f1 || 0",
+      "0 || f1",
+      "f1 || f1",
+      "f1 || 2",
+      "f2 && 1",
+      "1 && f2",
+      "f2 || 0",
+      "0 || f2",
+      "f2 || f2",
+      "f2 || f3",
+      "!f1",
+      "!f2",
+      "-f2",
+      // to_int truncates toward zero, turns NaN into 0 and saturates infinity
+      "~f3",
+      "~f4",
+      "f3 | 0",
+      "f4 & -1",
+      "f5 | 0",
+      "-f5 | 0",
+      "f1 ^ 5",
+      "f3 << 2",
+      "r4 >> 4",
+      "f4 >> 1",
+  };
+
+  for (const std::string_view text : EXPRESSIONS)
+    ExpectSameResult(text);
+}
+
+TEST_F(ExpressionTest, DeepExpressionFallsBackToInterpreter)
+{
+  ExpectSameResult(NestedSum(20));
+  ExpectSameResult(NestedSum(40), false);
+}
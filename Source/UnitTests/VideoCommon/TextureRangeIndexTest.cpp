@@ -0,0 +1,66 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "VideoCommon/TextureRangeIndex.h"
+
+namespace
+{
+std::vector<int> FindOverlapping(const TextureRangeIndex<int>& index, u32 addr, u32 size)
+{
+  std::vector<int> result;
+  index.FindOverlapping(addr, size, result);
+  return result;
+}
+}  // namespace
+
+TEST(TextureRangeIndex, SameAddressKeepsInsertionOrder)
+{
+  // A large EFB copy followed by a newer, smaller one at the same address. They fall into
+  // different size classes, but the older one must still come first.
+  TextureRangeIndex<int> index;
+  index.Add(0x80001000, 0x20000, 1);
+  index.Add(0x80001000, 0x400, 2);
+  EXPECT_EQ(FindOverlapping(index, 0x80001000, 0x400), (std::vector<int>{1, 2}));
+
+  TextureRangeIndex<int> reversed;
+  reversed.Add(0x80001000, 0x400, 2);
+  reversed.Add(0x80001000, 0x20000, 1);
+  EXPECT_EQ(FindOverlapping(reversed, 0x80001000, 0x400), (std::vector<int>{2, 1}));
+}
+
+TEST(TextureRangeIndex, AddressOrder)
+{
+  TextureRangeIndex<int> index;
+  index.Add(0x3000, 0x100, 3);
+  index.Add(0x1000, 0x4000, 1);
+  index.Add(0x2000, 0x10, 2);
+  index.Add(0x1000, 0x10, 4);
+  EXPECT_EQ(FindOverlapping(index, 0x1000, 0x3000), (std::vector<int>{1, 4, 2, 3}));
+}
+
+TEST(TextureRangeIndex, LooksBackBySizeClass)
+{
+  TextureRangeIndex<int> index;
+  index.Add(0x1000, 0x1000, 1);  // Ends at 0x2000
+  index.Add(0x1F00, 0x100, 2);   // Ends at 0x2000
+  index.Add(0x0000, 0x100, 3);   // Ends at 0x100
+  EXPECT_EQ(FindOverlapping(index, 0x1FFF, 1), (std::vector<int>{1, 2}));
+  EXPECT_EQ(FindOverlapping(index, 0x3000, 0x100), (std::vector<int>{}));
+}
+
+TEST(TextureRangeIndex, Remove)
+{
+  TextureRangeIndex<int> index;
+  index.Add(0x1000, 0x100, 1);
+  index.Add(0x1000, 0x100, 2);
+  EXPECT_TRUE(index.Remove(0x1000, 0x100, 1));
+  EXPECT_FALSE(index.Remove(0x1000, 0x100, 1));
+  EXPECT_EQ(FindOverlapping(index, 0x1000, 0x100), (std::vector<int>{2}));
+
+  index.Clear();
+  EXPECT_EQ(FindOverlapping(index, 0x1000, 0x100), (std::vector<int>{}));
+}